@@ -0,0 +1,170 @@
+#include "io/binary_triplets.h"
+#include "server/protocol.h"
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+
+#include <unistd.h>
+#include <sys/un.h>
+#include <sys/socket.h>
+
+
+using namespace tektask::io;
+using namespace tektask::server;
+
+namespace
+{
+    constexpr std::string_view USAGE{
+        "Usage: se_solver_client <socket> [--input <path|->] [--input-format text|binary] [a b c ...]"
+    };
+
+    /**
+     * @brief Connects to the solver daemon socket.
+     *
+     * @throws if the daemon is not available.
+     */
+    int connectTo(const std::string& socketPath)
+    {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (socketPath.empty() || socketPath.size() >= sizeof(address.sun_path))
+        {
+            throw std::invalid_argument("Invalid input: invalid socket path " + socketPath);
+        }
+        socketPath.copy(address.sun_path, socketPath.size());
+
+        const int fd{::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0)};
+        if (fd < 0 || ::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+        {
+            const auto error{errno};
+            if (fd >= 0)
+            {
+                ::close(fd);
+            }
+            throw std::system_error(error, std::generic_category(), "Failed to connect to " + socketPath);
+        }
+        return fd;
+    }
+
+    std::string readText(const std::string& path)
+    {
+        if (path == "-")
+        {
+            return {std::istreambuf_iterator<char>{std::cin}, std::istreambuf_iterator<char>{}};
+        }
+
+        std::ifstream file{path, std::ios::binary};
+        if (!file)
+        {
+            throw std::invalid_argument("Invalid input: failed to open " + path);
+        }
+        return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    }
+
+    /**
+     * @brief Packs records of a binary triplets file into request payload.
+     */
+    std::string readBinary(const std::string& path)
+    {
+        const BinaryTripletReader reader{path};
+        std::string payload(reader.size() * BINARY_TRIPLETS_RECORD_SIZE, '\0');
+        auto* record{reinterpret_cast<std::byte*>(payload.data())};
+        for (std::size_t i = 0; i < reader.size(); ++i, record += BINARY_TRIPLETS_RECORD_SIZE)
+        {
+            const auto triplet{reader[i]};
+            storeLittleEndian(triplet.a, record);
+            storeLittleEndian(triplet.b, record + sizeof(int64_t));
+            storeLittleEndian(triplet.c, record + 2 * sizeof(int64_t));
+        }
+        return payload;
+    }
+}
+
+int main(int argc, const char* argv[])
+{
+    try
+    {
+        if (argc < 3)
+        {
+            throw std::invalid_argument(std::string{USAGE});
+        }
+
+        // coefficients go as whitespace separated text, the daemon validates them like se_solver does
+        std::string inputPath{};
+        auto format{PayloadFormat::Text};
+        std::string payload{};
+        for (int i = 2; i < argc; ++i)
+        {
+            const std::string_view arg{argv[i]};
+            if ((arg == "--input" || arg == "--input-format") && i + 1 >= argc)
+            {
+                throw std::invalid_argument(std::string{USAGE});
+            }
+            if (arg == "--input")
+            {
+                inputPath = argv[++i];
+            }
+            else if (arg == "--input-format")
+            {
+                const std::string_view value{argv[++i]};
+                if (value != "text" && value != "binary")
+                {
+                    throw std::invalid_argument("Invalid input: unknown input format " + std::string{value});
+                }
+                format = value == "binary" ? PayloadFormat::Binary : PayloadFormat::Text;
+            }
+            else
+            {
+                payload.append(arg).push_back(' ');
+            }
+        }
+
+        if (!inputPath.empty())
+        {
+            if (!payload.empty())
+            {
+                throw std::invalid_argument("Invalid input: --input can't be combined with command line coefficients");
+            }
+            payload = format == PayloadFormat::Binary ? readBinary(inputPath) : readText(inputPath);
+        }
+        else if (format == PayloadFormat::Binary)
+        {
+            throw std::invalid_argument("Invalid input: binary input format requires --input file path");
+        }
+
+        const int fd{connectTo(argv[1])};
+        Frame response{};
+        try
+        {
+            writeFrame(fd, static_cast<uint8_t>(format), payload);
+            if (!readFrame(fd, response))
+            {
+                throw std::runtime_error("Solver closed the connection");
+            }
+        }
+        catch (...)
+        {
+            ::close(fd);
+            throw;
+        }
+        ::close(fd);
+
+        if (response.kind != static_cast<uint8_t>(ResponseStatus::Ok))
+        {
+            throw std::invalid_argument(response.payload);
+        }
+        std::cout.write(response.payload.data(), static_cast<std::streamsize>(response.payload.size()));
+        std::cout.flush();
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
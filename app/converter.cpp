@@ -0,0 +1,78 @@
+#include "cli/stream_parser.h"
+#include "io/binary_triplets.h"
+
+#include <fstream>
+#include <iostream>
+#include <string_view>
+
+
+using namespace tektask::io;
+using namespace tektask::cli_parser;
+using namespace tektask::utils::types;
+
+namespace
+{
+    /**
+     * @brief Converts text triplets into binary triplets file.
+     *
+     * Invalid triplets are reported and skipped, the same way solver does it,
+     * so record indexes in the output match solver Triplet::id order.
+     *
+     * @return Number of converted triplets.
+     */
+    std::size_t convert(std::istream& input, const std::string& outputPath)
+    {
+        BinaryTripletWriter writer{outputPath};
+        StreamParser parser{input};
+
+        std::vector<Triplet> chunk{};
+        while (parser.next(chunk))
+        {
+            for (const auto& triplet : chunk)
+            {
+                writer.write(triplet);
+            }
+        }
+
+        writer.finish();
+        return writer.count();
+    }
+}
+
+int main(int argc, const char* argv[])
+{
+    try
+    {
+        if (argc != 3)
+        {
+            throw std::invalid_argument("Usage: se_solver_convert <input.txt|-> <output.bin>");
+        }
+
+        const std::string inputPath{argv[1]};
+        const std::string outputPath{argv[2]};
+
+        std::size_t count{0};
+        if (inputPath == "-")
+        {
+            count = convert(std::cin, outputPath);
+        }
+        else
+        {
+            std::ifstream file{inputPath, std::ios::binary};
+            if (!file)
+            {
+                throw std::invalid_argument("Invalid input: failed to open " + inputPath);
+            }
+            count = convert(file, outputPath);
+        }
+
+        std::cerr << "converted " << count << " triplets into " << outputPath << std::endl;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
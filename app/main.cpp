@@ -1,66 +1,928 @@
 #include "cli/cli_parser.h"
+#include "cli/stream_parser.h"
+#include "cache/solution_cache.h"
 #include "resolver/quadratic_resolver.h"
 #include "queue/blocking_queue.h"
+#include "queue/lock_free_queue.h"
+#include "queue/range_queue.h"
+#include "queue/work_stealing_queue.h"
+#include "io/binary_triplets.h"
+#include "io/binary_results.h"
+#include "output/parallel_formatter.h"
+#include "output/reorder_buffer.h"
+#include "output/output_writer.h"
+#include "output/rejected_log.h"
+#include "output/solution_summary.h"
+#include "planner/calibration.h"
+#include "planner/execution_planner.h"
+#include "server/solver_server.h"
+#include "stats/stats.h"
+#include "thread/chunked_range.h"
+#include "thread/cpu_topology.h"
+#include "thread/thread_pool.h"
 
+#include <memory>
+#include <cstddef>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <type_traits>
 #include <iostream>
 #include <thread>
 
+#include <fcntl.h>
+#include <csignal>
+#include <unistd.h>
+#include <pthread.h>
 
+
+using namespace tektask::io;
+using namespace tektask::cache;
+using namespace tektask::output;
+using namespace tektask::stats;
+using namespace tektask::thread;
+using namespace tektask::server;
+using namespace tektask::planner;
 using namespace tektask::queue;
 using namespace tektask::resolver;
 using namespace tektask::cli_parser;
 using namespace tektask::utils::types;
 
-int main(int argc, const char* argv[])
+namespace
 {
-    try
-    {
-        using Queue = BlockingQueue<Triplet>;
-        using Resolver = QuadraticEquationResolver<Queue>;
-        using ResolveBuffer = std::vector<EquationSolveResult>;
+    // number of triplets enqueued under a single queue lock
+    constexpr std::size_t PUSH_BATCH_SIZE{1024};
 
-        // parse cmd input and prepare proper data for computation
-        auto params{CliParser{}.parse(argc, argv)};
+    // input bytes read per parsing thread, parts are parsed in parallel
+    constexpr std::size_t PARSE_CHUNK_SIZE{256 * 1024};
+    static_assert(PlannerConfig::MAX_SERIAL_BYTES <= PARSE_CHUNK_SIZE, "serial text input has to fit a single chunk");
 
-        // determine optimal thread count
+    // amount of formatted text collected by the ordered writer before a single write
+    constexpr std::size_t OUTPUT_BUFFER_SIZE{256 * 1024};
+
+    // single formatted line, newline included
+    constexpr std::size_t MAX_LINE_LENGTH{MAX_RESULT_LENGTH + 1};
+
+    /**
+     * @brief Determines hardware threads count.
+     */
+    uint32_t hardwareThreadCount()
+    {
         auto threadCount{static_cast<uint32_t>(std::thread::hardware_concurrency())};
-        threadCount = (threadCount == 0 ? 4 : threadCount);
+        return threadCount == 0 ? 4 : threadCount;
+    }
+
+    /**
+     * @brief Shared pipeline resources, alive for the whole run.
+     */
+    struct Runtime
+    {
+        // resolver workers, one pipeline thread is left for the producer, nullptr for serial jobs
+        ThreadPool* pool;
+        // optional solution cache shared between resolvers
+        SolutionCache* cache;
+        // parsing and formatting parallelism, the calling thread included
+        uint32_t threadCount;
+        // text results go to the descriptor, binary results into the file
+        OutputFormat outputFormat;
+        int outputFd;
+        std::string outputPath;
+        // statistics are reported, resolvers record them
+        bool instrumented;
+        // only a summary of the solutions is printed, resolvers accumulate it per worker
+        bool aggregate;
+    };
+
+    /**
+     * @brief Storage the resolver of a worker writes into: the shared one, or the worker own summary shard.
+     */
+    template <typename StorageType>
+    StorageType& workerStorage(StorageType& output, uint32_t)
+    {
+        return output;
+    }
+
+    SolutionSummary& workerStorage(ShardedSummary& output, uint32_t worker)
+    {
+        return output.shard(worker);
+    }
+
+    /**
+     * @brief Held by every worker while its resolver runs, on exit summary shards are merged by a tree reduction.
+     *
+     * The reduction runs when the resolver throws too, workers merging the shard would wait for it forever otherwise.
+     */
+    template <typename StorageType>
+    std::nullptr_t finishOnExit(StorageType&, uint32_t)
+    {
+        return nullptr;
+    }
+
+    ShardedSummary::ReduceGuard finishOnExit(ShardedSummary& output, uint32_t worker)
+    {
+        return {output, worker};
+    }
+
+    /**
+     * @brief Starts resolvers on the pool workers, consuming the queue and writing numeric solutions into the storage.
+     *
+     * Resolvers are constructed on their workers, so their batch buffers are allocated
+     * on the worker NUMA node. Resolvers share the solution cache, if any.
+     * Without a pool the calling thread is the only resolver, it returns once the input is solved.
+     */
+    template <typename Options, typename QueueType, typename StorageType>
+    void runResolvers(Runtime& runtime, QueueType& input, StorageType& output)
+    {
+        using WorkerStorage = std::remove_reference_t<decltype(workerStorage(output, 0))>;
+        using Resolver = QuadraticEquationResolver<QueueType, WorkerStorage, Options>;
+
+        auto* cache{runtime.cache};
+        if (runtime.pool == nullptr)
+        {
+            [[maybe_unused]] const auto finishing{finishOnExit(output, 0)};
+            Resolver resolver{input, workerStorage(output, 0), cache};
+            resolver();
+            return;
+        }
+
+        runtime.pool->start([&input, &output, cache](uint32_t worker)
+        {
+            [[maybe_unused]] const auto finishing{finishOnExit(output, worker)};
+            Resolver resolver{input, workerStorage(output, worker), cache};
+            resolver();
+        });
+    }
+
+    /**
+     * @brief Starts resolvers specialized for the job: coefficient range and instrumentation are fixed per run.
+     *
+     * @param range Narrow only if every coefficient of the job is known to be in the exact double range.
+     */
+    template <typename QueueType, typename StorageType>
+    void runResolvers(Runtime& runtime, QueueType& input, StorageType& output,
+                      CoefficientRange range = CoefficientRange::Full)
+    {
+        constexpr auto FULL{CoefficientRange::Full};
+        constexpr auto NARROW{CoefficientRange::Narrow};
+
+        if (runtime.instrumented && range == NARROW)
+        {
+            runResolvers<ResolverOptions<NARROW, true>>(runtime, input, output);
+        }
+        else if (runtime.instrumented)
+        {
+            runResolvers<ResolverOptions<FULL, true>>(runtime, input, output);
+        }
+        else if (range == NARROW)
+        {
+            runResolvers<ResolverOptions<NARROW, false>>(runtime, input, output);
+        }
+        else
+        {
+            runResolvers<ResolverOptions<FULL, false>>(runtime, input, output);
+        }
+    }
+
+    /**
+     * @brief Number of resolvers runResolvers() starts, the calling thread is the only one without a pool.
+     */
+    uint32_t resolverCount(const Runtime& runtime)
+    {
+        return runtime.pool != nullptr ? runtime.pool->size() : 1;
+    }
+
+    /**
+     * @brief Creates the resolver input queue, a work-stealing one gets a worker slot per resolver.
+     */
+    template <typename QueueType>
+    QueueType createQueue(const Runtime& runtime)
+    {
+        if constexpr (std::is_same_v<QueueType, WorkStealingQueue<Triplet>>)
+        {
+            return QueueType{resolverCount(runtime)};
+        }
+        else
+        {
+            return QueueType{};
+        }
+    }
 
-        // prepare resolver input queue and result storage
-        ResolveBuffer output(params.triplets.size());
-        Queue input{};
+    /**
+     * @brief Waits for the resolvers started by runResolvers(), serial ones are done by then.
+     */
+    void waitResolvers(Runtime& runtime)
+    {
+        if (runtime.pool != nullptr)
+        {
+            runtime.pool->wait();
+        }
+    }
 
-        // create and run resolver threads
-        std::vector<std::thread> resolveConsumers;
-        resolveConsumers.reserve(threadCount - 1);
-        for (int i = 1; i < threadCount; ++i)
+    /**
+     * @brief Creates the resolver pool, pins the calling thread and the workers if CPUs are given.
+     *
+     * The calling thread keeps the whole CPU set, so threads it starts later stay inside it,
+     * workers get one CPU each, filling the node of the calling thread first.
+     * Serial jobs get no pool, only the calling thread is pinned.
+     */
+    std::unique_ptr<ThreadPool> createPool(const CliArgs& params, uint32_t threadCount, ExecutionPlan plan)
+    {
+        if (plan == ExecutionPlan::Serial)
         {
-            resolveConsumers.emplace_back(Resolver(input, output));
+            if (!params.cpus.empty())
+            {
+                // placement validates the CPUs
+                static_cast<void>(CpuTopology::detect().place(params.cpus, 1));
+                setCurrentThreadAffinity(params.cpus);
+            }
+            return nullptr;
         }
 
-        // push data into the queue for resolvers
-        for (int i = 0; i < params.triplets.size(); ++i)
+        const auto workerCount{std::max<uint32_t>(threadCount - 1, 1)};
+        if (params.cpus.empty())
         {
-            auto& triplet{params.triplets[i]};
-            triplet.id = i;
-            input.waitPush(std::move(triplet));
+            return std::make_unique<ThreadPool>(workerCount);
         }
 
-        // no more data to produce, shutdown queue, let consumers drain remaining data
-        input.shutdown();
+        // placement validates the CPUs before the calling thread affinity is touched
+        const auto topology{CpuTopology::detect()};
+        auto placement{topology.place(params.cpus, workerCount + 1)};
+        if (setCurrentThreadAffinity(params.cpus))
+        {
+            placement = topology.place(params.cpus, workerCount + 1, currentCpu());
+        }
 
-        // join resolver threads
-        for (auto& thread : resolveConsumers)
+        // the first CPU of the placement is left for the calling thread
+        placement.erase(placement.begin());
+        return std::make_unique<ThreadPool>(workerCount, std::move(placement));
+    }
+
+    /**
+     * @brief Workers parsing the other parts of streamed input chunks, none if the pipeline has a single thread.
+     *
+     * Resolvers hold the resolver pool for the whole stream, so the parser gets its own
+     * persistent workers, created once per input instead of threads per chunk. They inherit
+     * the CPU set of the calling thread.
+     */
+    std::unique_ptr<ThreadPool> createParsePool(const Runtime& runtime)
+    {
+        if (runtime.threadCount <= 1)
+        {
+            return nullptr;
+        }
+        return std::make_unique<ThreadPool>(runtime.threadCount - 1);
+    }
+
+    /**
+     * @brief Formats numeric solutions in parallel and prints them in the order they were received.
+     *
+     * Solutions are formatted window by window into reused chunks, so the text of the whole
+     * input never exists at once, every window goes out with a single writev().
+     */
+    template <typename SourceType>
+    void printSolutions(const SourceType& triplets, const std::vector<EquationSolution>& solutions,
+                        uint32_t threadCount, ThreadPool* pool, int fd)
+    {
+        ScopedTimer timer{Stage::Output};
+        OutputWriter out{fd};
+        out.write("\n");
+
+        const auto window{FORMAT_WINDOW * std::max<uint32_t>(threadCount, 1)};
+        std::vector<std::string> chunks{};
+        for (std::size_t first = 0; first < solutions.size(); first += window)
+        {
+            formatParallel(triplets, solutions, first, std::min(first + window, solutions.size()), threadCount, chunks,
+                           pool);
+            out.write(chunks);
+        }
+        out.flush();
+    }
+
+    /**
+     * @brief Prints solutions in input order as soon as their contiguous prefix is ready.
+     *
+     * Runs on its own thread until all reserved ids are written, the separator line
+     * is printed in front of the first result only.
+     */
+    void printOrdered(ReorderBuffer& window, int fd)
+    {
+        // lines are formatted straight into the writer buffer, flushed here before it fills up
+        OutputWriter out{fd, OUTPUT_BUFFER_SIZE + MAX_LINE_LENGTH};
+        std::size_t pending{0};
+
+        auto flush = [&out, &pending]
+        {
+            ScopedTimer timer{Stage::Output};
+            out.flush();
+            pending = 0;
+        };
+
+        bool first{true};
+        window.drain([&](const Triplet& t, const EquationSolution& solution)
+        {
+            if (first)
+            {
+                out.write("\n");
+                first = false;
+            }
+
+            char* text{out.reserve(MAX_LINE_LENGTH)};
+            const auto length{formatResult(text, t, solution)};
+            text[length] = '\n';
+            out.commit(length + 1);
+
+            pending += length + 1;
+            if (pending >= OUTPUT_BUFFER_SIZE)
+            {
+                flush();
+            }
+        }, flush);
+        flush();
+    }
+
+    /**
+     * @brief Opens the text output descriptor, stdout unless --output names a file.
+     */
+    int openOutput(const CliArgs& params)
+    {
+        if (params.outputFormat == OutputFormat::Binary || params.outputPath.empty() || params.outputPath == "-")
+        {
+            return STDOUT_FILENO;
+        }
+
+        const auto fd{::open(params.outputPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644)};
+        if (fd < 0)
+        {
+            throw std::runtime_error("Invalid input: can't open output file " + params.outputPath);
+        }
+        return fd;
+    }
+
+    /**
+     * @brief Appends records of the rejected triplets in front of the given id.
+     */
+    void writeRejected(BinaryResultWriter& out, RejectedLog& rejected, int64_t id)
+    {
+        for (auto count{rejected.take(id)}; count > 0; --count)
+        {
+            out.writeRejected();
+        }
+    }
+
+    /**
+     * @brief Writes numeric solutions as binary result records, rejected triplets keep their input positions.
+     */
+    template <typename SourceType>
+    void writeSolutions(const SourceType& triplets, const std::vector<EquationSolution>& solutions,
+                        const std::vector<int64_t>& rejectedIds, const std::string& path)
+    {
+        ScopedTimer timer{Stage::Output};
+        RejectedLog rejected{};
+        rejected.add(rejectedIds);
+
+        BinaryResultWriter out{path};
+        for (std::size_t id = 0; id < solutions.size(); ++id)
+        {
+            writeRejected(out, rejected, static_cast<int64_t>(id));
+            out.write(triplets[id], solutions[id]);
+        }
+        writeRejected(out, rejected, std::numeric_limits<int64_t>::max());
+        out.finish();
+    }
+
+    /**
+     * @brief Writes binary result records in input order as soon as their contiguous prefix is ready.
+     *
+     * The caller opens and finishes the file, so its errors are reported by the calling thread.
+     */
+    void writeOrdered(ReorderBuffer& window, RejectedLog& rejected, BinaryResultWriter& out)
+    {
+        window.drain([&](const Triplet& t, const EquationSolution& solution)
+        {
+            writeRejected(out, rejected, t.id);
+            out.write(t, solution);
+        }, [] {});
+
+        ScopedTimer timer{Stage::Output};
+        writeRejected(out, rejected, std::numeric_limits<int64_t>::max());
+    }
+
+    /**
+     * @brief Outputs solutions of a completely solved input in the requested format.
+     */
+    template <typename SourceType>
+    void outputSolutions(const Runtime& runtime, const SourceType& triplets,
+                         const std::vector<EquationSolution>& solutions, const std::vector<int64_t>& rejected)
+    {
+        if (runtime.outputFormat == OutputFormat::Binary)
+        {
+            writeSolutions(triplets, solutions, rejected, runtime.outputPath);
+        }
+        else
+        {
+            // resolvers are done, their idle workers format the other windows parts
+            printSolutions(triplets, solutions, runtime.threadCount, runtime.pool, runtime.outputFd);
+        }
+    }
+
+    /**
+     * @brief Prints the summary of all resolvers, rejected triplets included.
+     */
+    void outputSummary(const Runtime& runtime, SolutionSummary& summary, uint64_t rejected)
+    {
+        ScopedTimer timer{Stage::Output};
+        summary.addRejected(rejected);
+
+        std::ostringstream text{};
+        text << '\n';
+        printSummary(summary, text);
+
+        OutputWriter out{runtime.outputFd};
+        out.write(text.str());
+        out.flush();
+    }
+
+    /**
+     * @brief Solves the input into per-resolver summaries and prints their reduction, nothing per equation is kept.
+     *
+     * @param rejected Number of triplets rejected by the parser.
+     */
+    template <typename QueueType>
+    void aggregateSolutions(Runtime& runtime, QueueType& input, uint64_t rejected,
+                            CoefficientRange range = CoefficientRange::Full)
+    {
+        ShardedSummary summaries{resolverCount(runtime)};
+        runResolvers(runtime, input, summaries, range);
+        waitResolvers(runtime);
+        outputSummary(runtime, summaries.total(), rejected);
+    }
+
+    /**
+     * @brief Solves triplets of a completely parsed input, without a queue.
+     *
+     * @param rejected Ids of the valid triplets following every rejected one.
+     */
+    void solveTriplets(const std::vector<Triplet>& triplets, const std::vector<int64_t>& rejected, Runtime& runtime)
+    {
+        // the whole input is known up front, resolvers claim id ranges and solve them in place
+        const auto workerCount{resolverCount(runtime)};
+        ChunkedRange<Triplet> input{triplets.data(), triplets.size(), workerCount, SOLVE_BLOCK_SIZE};
+
+        const auto range{fitsDoubleDiscriminant(triplets.data(), triplets.size()) ?
+                         CoefficientRange::Narrow : CoefficientRange::Full};
+        if (runtime.aggregate)
+        {
+            aggregateSolutions(runtime, input, rejected.size(), range);
+            return;
+        }
+
+        std::vector<EquationSolution> output(triplets.size());
+        runResolvers(runtime, input, output, range);
+        waitResolvers(runtime);
+
+        outputSolutions(runtime, triplets, output, rejected);
+    }
+
+    /**
+     * @brief Solves triplets parsed from the command line arguments.
+     */
+    void solveArguments(const CliArgs& params, Runtime& runtime)
+    {
+        solveTriplets(params.triplets, params.rejected, runtime);
+    }
+
+    /**
+     * @brief Solves a small text input on the calling thread: parses it whole, then solves and prints it.
+     *
+     * The input fits a single parser chunk, so diagnostics come in front of results, like in the pipeline.
+     */
+    void solveSerialText(std::istream& stream, Runtime& runtime)
+    {
+        StreamParser parser{stream, PARSE_CHUNK_SIZE, 1};
+        std::vector<Triplet> triplets{};
+        std::vector<int64_t> rejected{};
+        std::vector<Triplet> chunk{};
+        bool more{true};
+        while (more)
+        {
+            more = parser.next(chunk);
+            triplets.insert(triplets.end(), chunk.begin(), chunk.end());
+            rejected.insert(rejected.end(), parser.rejected().begin(), parser.rejected().end());
+        }
+
+        if (triplets.empty())
+        {
+            throw std::invalid_argument("Invalid input: no valid parameters");
+        }
+        solveTriplets(triplets, rejected, runtime);
+    }
+
+    /**
+     * @brief Solves triplets streamed from a file or stdin, parsing, solving and printing go in parallel.
+     *
+     * Results pass through a bounded reorder window, memory usage doesn't depend on input length.
+     */
+    template <typename QueueType>
+    void solveStream(std::istream& stream, Runtime& runtime)
+    {
+        ReorderBuffer output{};
+        auto input{createQueue<QueueType>(runtime)};
+
+        // binary records of rejected triplets are placed by the writer, text diagnostics are printed by the parser
+        const auto binary{runtime.outputFormat == OutputFormat::Binary};
+        RejectedLog rejected{};
+        std::unique_ptr<BinaryResultWriter> results{
+            binary ? std::make_unique<BinaryResultWriter>(runtime.outputPath) : nullptr
+        };
+
+        const auto parsers{createParsePool(runtime)};
+        StreamParser parser{stream, PARSE_CHUNK_SIZE, runtime.threadCount, nullptr, parsers.get()};
+        runResolvers(runtime, input, output);
+
+        // a failed write cancels the window, the producer stops and the error is rethrown here
+        std::exception_ptr writeError{};
+        std::thread writer{[&output, &rejected, &results, &writeError, binary, fd = runtime.outputFd]
+        {
+            try
+            {
+                binary ? writeOrdered(output, rejected, *results) : printOrdered(output, fd);
+            }
+            catch (...)
+            {
+                writeError = std::current_exception();
+                output.cancel();
+            }
+        }};
+
+        try
+        {
+            // parse input chunk by chunk, log rejections and reserve window slots before publishing new ids
+            std::vector<Triplet> chunk{};
+            bool writing{true};
+            while (writing && parser.next(chunk))
+            {
+                if (binary)
+                {
+                    rejected.add(parser.rejected());
+                }
+                for (std::size_t i = 0; writing && i < chunk.size(); i += PUSH_BATCH_SIZE)
+                {
+                    const auto count{std::min(chunk.size() - i, PUSH_BATCH_SIZE)};
+                    writing = output.waitReserve(chunk.data() + i, count);
+                    if (writing)
+                    {
+                        markPushed(chunk[i].id, chunk[i + count - 1].id + 1);
+                        input.waitPushBatch(chunk.begin() + i, chunk.begin() + i + count);
+                    }
+                }
+            }
+
+            if (binary)
+            {
+                rejected.add(parser.rejected());
+            }
+
+            input.shutdown();
+            output.finish();
+            waitResolvers(runtime);
+        }
+        catch (...)
+        {
+            // resolvers and the writer use the queue and the window, they have to stop before those are gone
+            input.shutdown();
+            output.cancel();
+            try
+            {
+                waitResolvers(runtime);
+            }
+            catch (...)
+            {
+            }
+            writer.join();
+            throw;
+        }
+
+        writer.join();
+        if (writeError)
+        {
+            std::rethrow_exception(writeError);
+        }
+
+        if (binary)
+        {
+            results->finish();
+        }
+
+        if (parser.parsedCount() == 0)
+        {
+            throw std::invalid_argument("Invalid input: no valid parameters");
+        }
+    }
+
+    /**
+     * @brief Aggregates triplets streamed from a file or stdin, resolvers add them into their summaries as they come.
+     *
+     * There is no reorder window and no writer, memory usage is bounded by the queue whatever the input length.
+     */
+    template <typename QueueType>
+    void aggregateStream(std::istream& stream, Runtime& runtime)
+    {
+        auto input{createQueue<QueueType>(runtime)};
+        ShardedSummary summaries{resolverCount(runtime)};
+
+        const auto parsers{createParsePool(runtime)};
+        StreamParser parser{stream, PARSE_CHUNK_SIZE, runtime.threadCount, nullptr, parsers.get()};
+        runResolvers(runtime, input, summaries);
+
+        uint64_t rejected{0};
+        try
+        {
+            std::vector<Triplet> chunk{};
+            while (parser.next(chunk))
+            {
+                rejected += parser.rejected().size();
+                for (std::size_t i = 0; i < chunk.size(); i += PUSH_BATCH_SIZE)
+                {
+                    const auto count{std::min(chunk.size() - i, PUSH_BATCH_SIZE)};
+                    markPushed(chunk[i].id, chunk[i + count - 1].id + 1);
+                    input.waitPushBatch(chunk.begin() + i, chunk.begin() + i + count);
+                }
+            }
+            rejected += parser.rejected().size();
+
+            input.shutdown();
+            waitResolvers(runtime);
+        }
+        catch (...)
+        {
+            // resolvers use the queue and the summaries, they have to stop before those are gone
+            input.shutdown();
+            try
+            {
+                waitResolvers(runtime);
+            }
+            catch (...)
+            {
+            }
+            throw;
+        }
+
+        if (parser.parsedCount() == 0)
+        {
+            throw std::invalid_argument("Invalid input: no valid parameters");
+        }
+        outputSummary(runtime, summaries.total(), rejected);
+    }
+
+    /**
+     * @brief Solves triplets from a memory mapped binary file, resolvers read records straight from the mapping.
+     */
+    void solveMapped(const std::string& path, Runtime& runtime)
+    {
+        BinaryTripletReader reader{path};
+        if (reader.size() == 0)
+        {
+            throw std::invalid_argument("Invalid input: no valid parameters");
+        }
+
+        RangeQueue input{reader};
+        if (runtime.aggregate)
+        {
+            aggregateSolutions(runtime, input, 0);
+            return;
+        }
+
+        std::vector<EquationSolution> output(reader.size());
+        runResolvers(runtime, input, output);
+        waitResolvers(runtime);
+
+        outputSolutions(runtime, reader, output, {});
+    }
+
+    /**
+     * @brief Prints or writes per-stage statistics, if requested.
+     */
+    void reportStats(const CliArgs& params)
+    {
+        if (!params.printStats && params.statsJsonPath.empty())
+        {
+            return;
+        }
+
+        const auto report{collect()};
+        if (params.printStats)
+        {
+            printReport(report, std::cerr);
+        }
+        if (!params.statsJsonPath.empty())
+        {
+            std::ofstream file{params.statsJsonPath};
+            if (!file)
+            {
+                throw std::invalid_argument("Invalid input: failed to open " + params.statsJsonPath);
+            }
+            writeJson(report, file);
+        }
+    }
+
+    /**
+     * @brief Blocks stop signals in the calling thread, threads started later inherit the mask.
+     *
+     * Has to run before any thread is started, so the signals are taken by sigwait() only.
+     */
+    sigset_t blockStopSignals()
+    {
+        sigset_t signals{};
+        sigemptyset(&signals);
+        sigaddset(&signals, SIGINT);
+        sigaddset(&signals, SIGTERM);
+        pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+        return signals;
+    }
+
+    /**
+     * @brief Serves solver requests on the Unix domain socket until SIGINT or SIGTERM.
+     */
+    void serve(const CliArgs& params, Runtime& runtime, const sigset_t& signals)
+    {
+        SolverServer server{*runtime.pool, runtime.cache};
+
+        std::thread signalWaiter{[&server, &signals]
+        {
+            int signal{0};
+            sigwait(&signals, &signal);
+            server.stop();
+        }};
+
+        std::exception_ptr error{};
+        try
+        {
+            server.serve(params.socketPath);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        // wake the waiter if serving ended without a signal
+        pthread_kill(signalWaiter.native_handle(), SIGTERM);
+        signalWaiter.join();
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    /**
+     * @brief Solves text from the stream, on the calling thread or through the pipeline fed by the given queue.
+     */
+    template <typename QueueType>
+    void solveTextStream(std::istream& stream, Runtime& runtime, ExecutionPlan plan)
+    {
+        if (plan == ExecutionPlan::Serial)
+        {
+            solveSerialText(stream, runtime);
+        }
+        else if (runtime.aggregate)
+        {
+            aggregateStream<QueueType>(stream, runtime);
+        }
+        else
+        {
+            solveStream<QueueType>(stream, runtime);
+        }
+    }
+
+    /**
+     * @brief Solves command line or streamed text input, streams feed resolvers through the given queue.
+     */
+    template <typename QueueType>
+    void solveText(CliArgs& params, Runtime& runtime, ExecutionPlan plan)
+    {
+        if (params.inputPath.empty())
+        {
+            solveArguments(params, runtime);
+        }
+        else if (params.inputPath == "-")
+        {
+            solveTextStream<QueueType>(std::cin, runtime, plan);
+        }
+        else
+        {
+            std::ifstream file{params.inputPath, std::ios::binary};
+            if (!file)
+            {
+                throw std::invalid_argument("Invalid input: failed to open " + params.inputPath);
+            }
+            solveTextStream<QueueType>(file, runtime, plan);
+        }
+    }
+
+    /**
+     * @brief Planner config file, --planner-config or the default one, empty if there is none.
+     */
+    std::string plannerConfigPath(const CliArgs& params)
+    {
+        return params.plannerConfigPath.empty() ? defaultConfigPath() : params.plannerConfigPath;
+    }
+
+    /**
+     * @brief Picks the execution plan of the job, the daemon always runs the pool.
+     */
+    ExecutionPlan planJob(const CliArgs& params, uint32_t threadCount)
+    {
+        if (!params.socketPath.empty())
+        {
+            return ExecutionPlan::Chunked;
+        }
+
+        const auto path{plannerConfigPath(params)};
+        const ExecutionPlanner planner{path.empty() ? PlannerConfig{} : PlannerConfig::load(path), threadCount};
+        return planner.plan(measureJob(params), params.executionMode);
+    }
+
+    /**
+     * @brief Measures planner thresholds of this machine and writes them into the planner config.
+     */
+    void calibratePlanner(const CliArgs& params, uint32_t threadCount)
+    {
+        const auto path{plannerConfigPath(params)};
+        if (path.empty())
+        {
+            throw std::invalid_argument("Invalid input: no planner config path, use --planner-config");
+        }
+
+        const auto calibration{calibrate(threadCount)};
+        const auto config{thresholds(calibration, threadCount)};
+        config.save(path);
+
+        std::cout << "pool start " << calibration.poolStartNs / 1000 << " us, solve "
+                  << calibration.solveNsPerTriplet << " ns/triplet, parse " << calibration.parseNsPerByte << " ns/byte\n"
+                  << "serial_max_triplets=" << config.serialMaxTriplets << ", serial_max_bytes=" << config.serialMaxBytes
+                  << " written to " << path << std::endl;
+    }
+}
+
+int main(int argc, const char* argv[])
+{
+    try
+    {
+        // parse cmd input and prepare proper data for computation
+        auto params{CliParser{hardwareThreadCount()}.parse(argc, argv)};
+
+        // optional solution cache for repeated and power of two scaled triplets
+        std::unique_ptr<SolutionCache> cache{};
+        if (params.cacheSize > 0)
+        {
+            cache = std::make_unique<SolutionCache>(params.cacheSize);
+        }
+
+        // stop signals of the daemon are handled by a dedicated thread
+        const auto signals{params.socketPath.empty() ? sigset_t{} : blockStopSignals()};
+
+        const auto threadCount{params.threadCount != 0 ? params.threadCount : hardwareThreadCount()};
+        if (params.calibrate)
+        {
+            calibratePlanner(params, threadCount);
+            return EXIT_SUCCESS;
+        }
+
+        // small jobs run on the calling thread alone, others on persistent resolver workers, pinned with --cpus
+        const auto plan{planJob(params, threadCount)};
+        const auto pool{createPool(params, threadCount, plan)};
+        const auto pipelineThreads{plan == ExecutionPlan::Serial ? 1 : threadCount};
+        // text results may be redirected into a file with --output
+        const auto outputFd{openOutput(params)};
+        const auto instrumented{params.printStats || !params.statsJsonPath.empty()};
+        Runtime runtime{pool.get(), cache.get(), pipelineThreads, params.outputFormat, outputFd, params.outputPath,
+                        instrumented, params.aggregate};
+
+        if (!params.socketPath.empty())
+        {
+            serve(params, runtime, signals);
+        }
+        else if (params.inputFormat == InputFormat::Binary)
+        {
+            solveMapped(params.inputPath, runtime);
+        }
+        else if (params.queueKind == QueueKind::LockFree)
+        {
+            solveText<LockFreeQueue<Triplet>>(params, runtime, plan);
+        }
+        else if (params.queueKind == QueueKind::WorkStealing)
+        {
+            solveText<WorkStealingQueue<Triplet>>(params, runtime, plan);
+        }
+        else
         {
-            thread.join();
+            solveText<BlockingQueue<Triplet>>(params, runtime, plan);
         }
 
-        // print resolved results
-        std::cout << "\n";
-        for (const auto& solution : output)
+        if (outputFd != STDOUT_FILENO)
         {
-            std::cout << solution.result << std::endl;
+            ::close(outputFd);
         }
+        reportStats(params);
     }
     catch (const std::exception& e)
     {
@@ -0,0 +1,67 @@
+#include "io/binary_results.h"
+#include "output/output_writer.h"
+#include "resolver/result_formatter.h"
+
+#include <iostream>
+#include <unistd.h>
+
+
+using namespace tektask::io;
+using namespace tektask::output;
+using namespace tektask::resolver;
+
+namespace
+{
+    // a formatted result followed by a line break
+    static constexpr std::size_t MAX_LINE_LENGTH{MAX_RESULT_LENGTH + 1};
+
+    /**
+     * @brief Prints solved records of a binary results file the way solver text output looks.
+     *
+     * Rejected records carry no coefficients, they are skipped.
+     */
+    void dump(const BinaryResultReader& results)
+    {
+        OutputWriter out{STDOUT_FILENO};
+        out.write("\n");
+
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+            const auto result{results[i]};
+            if (!result.valid)
+            {
+                continue;
+            }
+
+            char* text{out.reserve(MAX_LINE_LENGTH)};
+            const auto length{formatResult(text, result.triplet, result.solution)};
+            text[length] = '\n';
+            out.commit(length + 1);
+        }
+        out.flush();
+    }
+}
+
+int main(int argc, const char* argv[])
+{
+    try
+    {
+        if (argc != 2)
+        {
+            throw std::invalid_argument("Usage: se_solver_dump <results.bin>");
+        }
+
+        const BinaryResultReader results{argv[1]};
+        dump(results);
+
+        std::cerr << "dumped " << results.size() - results.rejectedCount() << " results, "
+            << results.rejectedCount() << " rejected" << std::endl;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,58 @@
+#ifndef BENCH_DATASET_H
+#define BENCH_DATASET_H
+
+#include "utils/types/types.h"
+
+#include <array>
+#include <random>
+#include <vector>
+#include <string>
+
+namespace tektask::bench
+{
+    // coefficients which hit every solve case, the rest of a dataset is random
+    static constexpr std::array<utils::types::Triplet, 6> CASE_TRIPLETS{
+        {
+            {0, 0, 0}, // InfiniteRoots
+            {0, 0, 1}, // NoSolution
+            {0, 2, 1}, // Linear
+            {1, 0, 1}, // NoRealRoots
+            {1, 2, 1}, // SingleRoot
+            {1, -3, 2}, // TwoRoots
+        }
+    };
+
+    /**
+     * @brief Generates a reproducible dataset, ids follow generation order.
+     *
+     * @param count Number of triplets.
+     * @param range Coefficients are taken from [-range, range].
+     */
+    inline std::vector<utils::types::Triplet> generateTriplets(std::size_t count, int64_t range = 1000)
+    {
+        std::mt19937_64 engine{count};
+        std::uniform_int_distribution<int64_t> coefficient{-range, range};
+
+        std::vector<utils::types::Triplet> triplets(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            triplets[i] = {coefficient(engine), coefficient(engine), coefficient(engine), static_cast<int64_t>(i)};
+        }
+        return triplets;
+    }
+
+    /**
+     * @brief Formats triplets as whitespace separated text, one triplet per line.
+     */
+    inline std::string toText(const std::vector<utils::types::Triplet>& triplets)
+    {
+        std::string text{};
+        for (const auto& t : triplets)
+        {
+            text += std::to_string(t.a) + ' ' + std::to_string(t.b) + ' ' + std::to_string(t.c) + '\n';
+        }
+        return text;
+    }
+}
+
+#endif //BENCH_DATASET_H
@@ -0,0 +1,84 @@
+#include "dataset.h"
+#include "cli/cli_parser.h"
+#include "cli/stream_parser.h"
+#include "cli/triplet_tokens.h"
+
+#include <benchmark/benchmark.h>
+
+#include <thread>
+#include <sstream>
+
+using namespace tektask::bench;
+using namespace tektask::cli_parser;
+using namespace tektask::utils::types;
+
+namespace
+{
+    uint32_t parserThreads(const benchmark::State& state)
+    {
+        return state.range(1) == 0 ? 1 : std::max(std::thread::hardware_concurrency(), 1u);
+    }
+}
+
+// CliParser::_parseTriplet is private, its per token work is parseCoefficient
+static void BM_ParseCoefficient(benchmark::State& state)
+{
+    const std::array<std::string, 6> tokens{"0", "-1", "42", "-1000", "9223372036854775807", "12x"};
+
+    std::size_t i{0};
+    for (auto _ : state)
+    {
+        int64_t value{};
+        benchmark::DoNotOptimize(parseCoefficient(tokens[i++ % tokens.size()], value));
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ParseCoefficient);
+
+// arg 0: triplets count, arg 1: 0 for serial, 1 for parallel parsing
+static void BM_CliParserParse(benchmark::State& state)
+{
+    const auto triplets{generateTriplets(static_cast<std::size_t>(state.range(0)))};
+
+    std::vector<std::string> tokens{"se_solver"};
+    for (const auto& t : triplets)
+    {
+        tokens.push_back(std::to_string(t.a));
+        tokens.push_back(std::to_string(t.b));
+        tokens.push_back(std::to_string(t.c));
+    }
+    std::vector<const char*> argv{};
+    for (const auto& token : tokens)
+    {
+        argv.push_back(token.c_str());
+    }
+
+    CliParser parser{parserThreads(state)};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(parser.parse(static_cast<int>(argv.size()), argv.data()));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CliParserParse)->ArgsProduct({{1 << 10, 1 << 14, 1 << 17}, {0, 1}});
+
+static void BM_StreamParser(benchmark::State& state)
+{
+    const auto text{toText(generateTriplets(static_cast<std::size_t>(state.range(0))))};
+
+    for (auto _ : state)
+    {
+        std::istringstream stream{text};
+        StreamParser parser{stream, StreamParser::DEFAULT_CHUNK_SIZE, parserThreads(state)};
+
+        std::vector<Triplet> chunk{};
+        while (parser.next(chunk))
+        {
+            benchmark::DoNotOptimize(chunk.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+BENCHMARK(BM_StreamParser)->ArgsProduct({{1 << 14, 1 << 20}, {0, 1}})->Unit(benchmark::kMillisecond);
@@ -0,0 +1,110 @@
+#include "queue/blocking_queue.h"
+#include "queue/lock_free_queue.h"
+#include "utils/types/types.h"
+
+#include <benchmark/benchmark.h>
+
+#include <thread>
+
+using namespace tektask::queue;
+using namespace tektask::utils::types;
+
+namespace
+{
+    // triplets passed through the queue per iteration
+    constexpr std::size_t ITEMS_PER_RUN{1 << 16};
+
+    // items pushed or popped under a single lock by batched runs
+    constexpr std::size_t BATCH_SIZE{256};
+
+    /**
+     * @brief Moves ITEMS_PER_RUN triplets through a fresh queue with the given producer and consumer counts.
+     */
+    template <typename QueueType, bool BATCHED>
+    void passThrough(std::size_t producers, std::size_t consumers)
+    {
+        QueueType queue{};
+
+        std::vector<std::thread> consumerThreads{};
+        for (std::size_t i = 0; i < consumers; ++i)
+        {
+            consumerThreads.emplace_back([&queue]
+            {
+                if constexpr (BATCHED)
+                {
+                    std::vector<Triplet> batch{};
+                    while (queue.waitPopBatch(batch, BATCH_SIZE) != 0)
+                    {
+                        benchmark::DoNotOptimize(batch.data());
+                    }
+                }
+                else
+                {
+                    Triplet item{};
+                    while (queue.waitPop(item))
+                    {
+                        benchmark::DoNotOptimize(item);
+                    }
+                }
+            });
+        }
+
+        std::vector<std::thread> producerThreads{};
+        for (std::size_t i = 0; i < producers; ++i)
+        {
+            producerThreads.emplace_back([&queue, i, producers]
+            {
+                const auto first{ITEMS_PER_RUN * i / producers};
+                const auto last{ITEMS_PER_RUN * (i + 1) / producers};
+                if constexpr (BATCHED)
+                {
+                    std::vector<Triplet> batch(BATCH_SIZE);
+                    for (auto id{first}; id < last; id += BATCH_SIZE)
+                    {
+                        const auto count{std::min(BATCH_SIZE, last - id)};
+                        queue.waitPushBatch(batch.begin(), batch.begin() + count);
+                    }
+                }
+                else
+                {
+                    for (auto id{first}; id < last; ++id)
+                    {
+                        queue.waitPush(Triplet{1, 2, 3, static_cast<int64_t>(id)});
+                    }
+                }
+            });
+        }
+
+        for (auto& thread : producerThreads)
+        {
+            thread.join();
+        }
+        queue.shutdown();
+        for (auto& thread : consumerThreads)
+        {
+            thread.join();
+        }
+    }
+}
+
+// arg 0: producers count, arg 1: consumers count
+template <typename QueueType, bool BATCHED>
+static void BM_QueuePushPop(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        passThrough<QueueType, BATCHED>(static_cast<std::size_t>(state.range(0)),
+                                        static_cast<std::size_t>(state.range(1)));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(ITEMS_PER_RUN));
+}
+
+#define QUEUE_BENCHMARK(...) \
+    BENCHMARK_TEMPLATE(BM_QueuePushPop, __VA_ARGS__) \
+        ->ArgsProduct({{1, 2, 4}, {1, 2, 4, 8}})->ArgNames({"producers", "consumers"}) \
+        ->UseRealTime()->Unit(benchmark::kMillisecond)
+
+QUEUE_BENCHMARK(BlockingQueue<Triplet>, false);
+QUEUE_BENCHMARK(BlockingQueue<Triplet>, true);
+QUEUE_BENCHMARK(LockFreeQueue<Triplet>, false);
+QUEUE_BENCHMARK(LockFreeQueue<Triplet>, true);
@@ -0,0 +1,160 @@
+#include "dataset.h"
+#include "resolver/quadratic_resolver.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace tektask::bench;
+using namespace tektask::storage;
+using namespace tektask::resolver;
+using namespace tektask::utils::types;
+
+namespace
+{
+    class DummyQueue
+    {
+    public:
+        using value_type = Triplet;
+    };
+
+    using Resolver = QuadraticEquationResolver<DummyQueue, std::vector<EquationSolution>>;
+
+    const std::array<const char*, CASE_TRIPLETS.size()> CASE_NAMES{
+        "InfiniteRoots", "NoSolution", "Linear", "NoRealRoots", "SingleRoot", "TwoRoots",
+    };
+}
+
+// arg 0: index into CASE_TRIPLETS, solve and format a single equation
+static void BM_Resolve(benchmark::State& state)
+{
+    const auto& triplet{CASE_TRIPLETS[state.range(0)]};
+    state.SetLabel(CASE_NAMES[state.range(0)]);
+
+    DummyQueue queue{};
+    std::vector<EquationSolution> storage(1);
+    const Resolver resolver{queue, storage};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(resolver.resolve(triplet));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Resolve)->DenseRange(0, CASE_TRIPLETS.size() - 1);
+
+// arg 0: index into CASE_TRIPLETS, solve a block kernel batch of the same equation into structured storage
+static void BM_ResolveBatch(benchmark::State& state)
+{
+    std::vector<Triplet> batch(SOLVE_BLOCK_SIZE, CASE_TRIPLETS[state.range(0)]);
+    for (std::size_t i = 0; i < batch.size(); ++i)
+    {
+        batch[i].id = static_cast<int64_t>(i);
+    }
+    state.SetLabel(CASE_NAMES[state.range(0)]);
+
+    DummyQueue queue{};
+    std::vector<EquationSolution> storage(batch.size());
+    Resolver resolver{queue, storage};
+    for (auto _ : state)
+    {
+        resolver.resolveBatch(batch.data(), batch.size());
+        benchmark::DoNotOptimize(storage.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(batch.size()));
+}
+BENCHMARK(BM_ResolveBatch)->DenseRange(0, CASE_TRIPLETS.size() - 1);
+
+// random coefficients, solve cases mixed within every block
+static void BM_ResolveBatchMixed(benchmark::State& state)
+{
+    const auto batch{generateTriplets(SOLVE_BLOCK_SIZE, 3)};
+
+    DummyQueue queue{};
+    std::vector<EquationSolution> storage(batch.size());
+    Resolver resolver{queue, storage};
+    for (auto _ : state)
+    {
+        resolver.resolveBatch(batch.data(), batch.size());
+        benchmark::DoNotOptimize(storage.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(batch.size()));
+}
+BENCHMARK(BM_ResolveBatchMixed);
+
+// arg 0: coefficient magnitude bits, beyond 26 bits every equation takes the exact wide path
+static void BM_ResolveBatchWide(benchmark::State& state)
+{
+    const auto bits{state.range(0)};
+    const auto batch{generateTriplets(SOLVE_BLOCK_SIZE, bits >= 63 ? INT64_MAX : (int64_t{1} << bits) - 1)};
+
+    DummyQueue queue{};
+    std::vector<EquationSolution> storage(batch.size());
+    Resolver resolver{queue, storage};
+    for (auto _ : state)
+    {
+        resolver.resolveBatch(batch.data(), batch.size());
+        benchmark::DoNotOptimize(storage.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(batch.size()));
+}
+BENCHMARK(BM_ResolveBatchWide)->Arg(20)->Arg(40)->Arg(63);
+
+namespace
+{
+    using Generic = ResolverOptions<>;
+    using FullPlain = ResolverOptions<CoefficientRange::Full, false>;
+    using NarrowInstrumented = ResolverOptions<CoefficientRange::Narrow, true>;
+    using NarrowPlain = ResolverOptions<CoefficientRange::Narrow, false>;
+
+    // text results fill the arena, a fresh one is taken outside of the timed region every so often
+    constexpr int64_t ARENA_REFRESH_ITERATIONS{1024};
+}
+
+// resolver instantiations against the generic one (Generic: full range, instrumented), mixed solve cases
+template <typename Options>
+static void BM_ResolveBatchStructured(benchmark::State& state)
+{
+    const auto batch{generateTriplets(SOLVE_BLOCK_SIZE, 1000)};
+
+    DummyQueue queue{};
+    std::vector<EquationSolution> storage(batch.size());
+    QuadraticEquationResolver<DummyQueue, std::vector<EquationSolution>, Options> resolver{queue, storage};
+    for (auto _ : state)
+    {
+        resolver.resolveBatch(batch.data(), batch.size());
+        benchmark::DoNotOptimize(storage.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(batch.size()));
+}
+BENCHMARK_TEMPLATE(BM_ResolveBatchStructured, Generic);
+BENCHMARK_TEMPLATE(BM_ResolveBatchStructured, FullPlain);
+BENCHMARK_TEMPLATE(BM_ResolveBatchStructured, NarrowInstrumented);
+BENCHMARK_TEMPLATE(BM_ResolveBatchStructured, NarrowPlain);
+
+template <typename Options>
+static void BM_ResolveBatchText(benchmark::State& state)
+{
+    using TextResolver = QuadraticEquationResolver<DummyQueue, std::vector<EquationSolveResult>, Options>;
+    const auto batch{generateTriplets(SOLVE_BLOCK_SIZE, 1000)};
+
+    DummyQueue queue{};
+    std::vector<EquationSolveResult> storage(batch.size());
+    auto arena{std::make_unique<TextArena>()};
+    int64_t iteration{0};
+    for (auto _ : state)
+    {
+        if (++iteration % ARENA_REFRESH_ITERATIONS == 0)
+        {
+            state.PauseTiming();
+            arena = std::make_unique<TextArena>();
+            state.ResumeTiming();
+        }
+
+        TextResolver resolver{queue, storage, *arena};
+        resolver.resolveBatch(batch.data(), batch.size());
+        benchmark::DoNotOptimize(storage.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(batch.size()));
+}
+BENCHMARK_TEMPLATE(BM_ResolveBatchText, Generic);
+BENCHMARK_TEMPLATE(BM_ResolveBatchText, FullPlain);
+BENCHMARK_TEMPLATE(BM_ResolveBatchText, NarrowInstrumented);
+BENCHMARK_TEMPLATE(BM_ResolveBatchText, NarrowPlain);
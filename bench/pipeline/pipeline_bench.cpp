@@ -0,0 +1,100 @@
+#include "io/binary_triplets.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <cstdlib>
+#include <fstream>
+#include <filesystem>
+
+using namespace tektask::io;
+using namespace tektask::utils::types;
+
+namespace
+{
+    enum class DatasetFormat : int64_t
+    {
+        Text,
+        Binary,
+    };
+
+    /**
+     * @brief Returns path of a generated dataset, generating it on first use.
+     *
+     * Datasets are reproducible and kept in the temp directory between runs,
+     * triplets are generated on the fly, so even 1e8 equations don't have to fit in memory.
+     */
+    std::filesystem::path dataset(std::size_t count, DatasetFormat format)
+    {
+        const auto directory{std::filesystem::temp_directory_path() / "se_solver_bench"};
+        std::filesystem::create_directories(directory);
+
+        const auto path{
+            directory / ("triplets_" + std::to_string(count) + (format == DatasetFormat::Text ? ".txt" : ".bin"))
+        };
+        if (std::filesystem::exists(path))
+        {
+            return path;
+        }
+
+        // write into a temporary file first, so an interrupted generation is never reused
+        const auto partial{path.string() + ".partial"};
+        std::mt19937_64 engine{count};
+        std::uniform_int_distribution<int64_t> coefficient{-1000, 1000};
+        if (format == DatasetFormat::Text)
+        {
+            std::ofstream file{partial, std::ios::binary};
+            std::string line{};
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                line = std::to_string(coefficient(engine));
+                line += ' ';
+                line += std::to_string(coefficient(engine));
+                line += ' ';
+                line += std::to_string(coefficient(engine));
+                line += '\n';
+                file.write(line.data(), static_cast<std::streamsize>(line.size()));
+            }
+        }
+        else
+        {
+            BinaryTripletWriter writer{partial};
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                writer.write({coefficient(engine), coefficient(engine), coefficient(engine)});
+            }
+            writer.finish();
+        }
+        std::filesystem::rename(partial, path);
+        return path;
+    }
+}
+
+// arg 0: equations count, arg 1: DatasetFormat, the whole application runs with output discarded
+static void BM_EndToEnd(benchmark::State& state)
+{
+    const auto count{static_cast<std::size_t>(state.range(0))};
+    const auto format{static_cast<DatasetFormat>(state.range(1))};
+    const auto path{dataset(count, format)};
+
+    const std::string command{
+        std::string{SE_SOLVER_PATH} + (format == DatasetFormat::Binary ? " --input-format binary" : "") +
+        " --input " + path.string() + " > /dev/null"
+    };
+
+    for (auto _ : state)
+    {
+        if (std::system(command.c_str()) != 0)
+        {
+            state.SkipWithError("se_solver failed");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::filesystem::file_size(path)));
+}
+BENCHMARK(BM_EndToEnd)
+    ->ArgsProduct({benchmark::CreateRange(1'000, 100'000'000, 10), {0, 1}})
+    ->ArgNames({"equations", "binary"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
@@ -1,4 +1,5 @@
 import subprocess
+import os
 import sys
 
 from scripts.python.build_utils import configure_and_build_project
@@ -63,6 +64,135 @@ def run_e2e_tests(exe_path):
             "expect_failure": False
         },
 
+        {
+            "name": "Stdin_Input",
+            "args": ["--input", "-"],
+            "stdin": "0 0 0\n1 -2 -3\n1 a 1\n2 -6 -8\n100 200",
+            "expected_output": "(1,a,1) => Invalid input: failed to parse triplet\n"
+                               "(100,200,) => Invalid input: parameter count must be a multiple of 3!\n\n"
+                               "(0, 0, 0) => infinite roots, no extremum\n"
+                               "(1, -2, -3) => (3, -1), Xmin=1\n"
+                               "(2, -6, -8) => (4, -1), Xmin=1.5\n",
+            "expect_failure": False
+        },
+        {
+            "name": "Stdin_Input_NoValidTriplets",
+            "args": ["--input", "-"],
+            "stdin": "1 abc 3",
+            "expected_output": "(1,abc,3) => Invalid input: failed to parse triplet\n"
+                               "Invalid input: no valid parameters",
+            "expect_failure": True
+        },
+        {
+            "name": "LockFree_Queue",
+            "args": ["--queue", "lockfree", "0", "0", "0", "1", "-2", "-3", "1", "2", "1"],
+            "expected_output": "(0, 0, 0) => infinite roots, no extremum\n"
+                               "(1, -2, -3) => (3, -1), Xmin=1\n"
+                               "(1, 2, 1) => (-1), Xmin=-1",
+            "expect_failure": False
+        },
+        {
+            "name": "WorkStealing_Queue_Stdin",
+            "args": ["--queue", "stealing", "--threads", "3", "--input", "-"],
+            "stdin": "0 0 0\n1 -2 -3\n1 a 1\n2 -6 -8\n1 2 1",
+            "expected_output": "(1,a,1) => Invalid input: failed to parse triplet\n\n"
+                               "(0, 0, 0) => infinite roots, no extremum\n"
+                               "(1, -2, -3) => (3, -1), Xmin=1\n"
+                               "(2, -6, -8) => (4, -1), Xmin=1.5\n"
+                               "(1, 2, 1) => (-1), Xmin=-1",
+            "expect_failure": False
+        },
+        {
+            "name": "Stats_Report_KeepsOutput",
+            "args": ["--stats-json", os.devnull, "1", "-2", "-3", "1", "2", "1"],
+            "expected_output": "(1, -2, -3) => (3, -1), Xmin=1\n"
+                               "(1, 2, 1) => (-1), Xmin=-1",
+            "expect_failure": False
+        },
+
+        {
+            "name": "Solution_Cache_ProportionalTriplets",
+            "args": ["--cache", "1024", "1", "-2", "-3", "-2", "4", "6", "1", "-2", "-3", "0", "0", "0"],
+            "expected_output": "(1, -2, -3) => (3, -1), Xmin=1\n"
+                               "(-2, 4, 6) => (-1, 3), Xmin=1\n"
+                               "(1, -2, -3) => (3, -1), Xmin=1\n"
+                               "(0, 0, 0) => infinite roots, no extremum",
+            "expect_failure": False
+        },
+
+        {
+            "name": "Thread_Pool_PinnedSingleThread",
+            "args": ["--threads", "1", "--cpus", "all", "1", "-2", "-3", "0", "0", "0"],
+            "expected_output": "(1, -2, -3) => (3, -1), Xmin=1\n"
+                               "(0, 0, 0) => infinite roots, no extremum",
+            "expect_failure": False
+        },
+
+        {
+            "name": "Thread_Pool_InvalidThreadCount",
+            "args": ["--threads", "0", "1", "-2", "-3"],
+            "expected_output": "Invalid input: invalid thread count 0",
+            "expect_failure": True
+        },
+
+        {
+            "name": "Planner_ParallelPlanSmallJob",
+            "args": ["--plan", "parallel", "--threads", "3", "1", "-2", "-3", "0", "0", "0"],
+            "expected_output": "(1, -2, -3) => (3, -1), Xmin=1\n"
+                               "(0, 0, 0) => infinite roots, no extremum",
+            "expect_failure": False
+        },
+
+        {
+            "name": "Planner_SerialPlanStdin",
+            "args": ["--plan", "serial", "--threads", "3", "--input", "-"],
+            "stdin": "1 -2 -3\n1 a 1\n2 -6 -8",
+            "expected_output": "(1,a,1) => Invalid input: failed to parse triplet\n\n"
+                               "(1, -2, -3) => (3, -1), Xmin=1\n"
+                               "(2, -6, -8) => (4, -1), Xmin=1.5\n",
+            "expect_failure": False
+        },
+
+        {
+            "name": "Planner_UnknownPlan",
+            "args": ["--plan", "chunked", "1", "-2", "-3"],
+            "expected_output": "Invalid input: unknown plan chunked",
+            "expect_failure": True
+        },
+
+        {
+            "name": "Aggregate_Summary",
+            "args": ["--aggregate", "0", "0", "0", "1", "-2", "-3", "1", "2", "1", "0", "2", "-4", "1", "x", "2"],
+            "expected_output": "(1,x,2) => Invalid input: failed to parse triplet\n\n"
+                               "equations: 4\n"
+                               "rejected: 1\n"
+                               "infinite roots: 1\n"
+                               "no solution: 0\n"
+                               "linear: 1\n"
+                               "no real roots: 0\n"
+                               "single root: 1\n"
+                               "two roots: 1\n"
+                               "Xmin: [-1, 1]\n"
+                               "roots: 4\n"
+                               "  (-2, -1]: 2\n"
+                               "  [2, 4): 2\n",
+            "expect_failure": False
+        },
+
+        {
+            "name": "Output_BinaryWithoutFile",
+            "args": ["--output-format", "binary", "1", "-2", "-3"],
+            "expected_output": "Invalid input: binary output format requires --output file path",
+            "expect_failure": True
+        },
+
+        {
+            "name": "Serve_WithInput",
+            "args": ["--serve", "/tmp/se_solver_e2e.sock", "1", "-2", "-3"],
+            "expected_output": "Invalid input: --serve can't be combined with input",
+            "expect_failure": True
+        },
+
         # add test here
     ]
 
@@ -72,6 +202,7 @@ def run_e2e_tests(exe_path):
         try:
             result = subprocess.run(
                 [exe_path] + case["args"],
+                input=case.get("stdin"),
                 text=True,
                 stdout=subprocess.PIPE,
                 stderr=subprocess.STDOUT,  # stdout | stderr
@@ -0,0 +1,284 @@
+#ifndef SOLUTION_CACHE_H
+#define SOLUTION_CACHE_H
+
+#include "resolver/exact_discriminant.h"
+#include "utils/constants/constants.h"
+#include "utils/types/types.h"
+
+#include <cmath>
+#include <mutex>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <algorithm>
+
+namespace tektask::cache
+{
+    /**
+     * @brief Triplet reduced by exact transformations only, equations sharing a key have the same solution.
+     */
+    struct NormalizedKey
+    {
+        int64_t a{0};
+        int64_t b{0};
+        int64_t c{0};
+
+        bool operator==(const NormalizedKey& other) const noexcept
+        {
+            return a == other.a && b == other.b && c == other.c;
+        }
+    };
+
+    /**
+     * @brief Divides coefficients by their common power of two and makes the first non-zero one positive.
+     *
+     * Only factors which keep solutions bit-identical are taken out, so (2, 4, 2) and
+     * (-1, -2, -1) both turn into (1, 2, 1), while (3, 6, 3) keeps its own key: sqrt(9D) / 6a
+     * doesn't round like sqrt(D) / 2a. Negation is exact on both solve paths, scaling by 2^k
+     * only on the plain double one, so coefficients beyond the exact double range keep
+     * their magnitudes. Coefficients which can't be negated (INT64_MIN) keep their sign,
+     * such triplets only match themselves.
+     */
+    inline NormalizedKey normalize(const utils::types::Triplet& t) noexcept
+    {
+        NormalizedKey key{t.a, t.b, t.c};
+        const auto bits{static_cast<uint64_t>(t.a) | static_cast<uint64_t>(t.b) | static_cast<uint64_t>(t.c)};
+        if (bits != 0 && resolver::fitsDoubleDiscriminant(t.a, t.b, t.c))
+        {
+            // negative values have the same trailing zeros in two's complement
+            const auto factor{int64_t{1} << __builtin_ctzll(bits)};
+            key = {t.a / factor, t.b / factor, t.c / factor};
+        }
+
+        const auto leading{key.a != 0 ? key.a : (key.b != 0 ? key.b : key.c)};
+        constexpr auto MIN{std::numeric_limits<int64_t>::min()};
+        if (leading < 0 && key.a != MIN && key.b != MIN && key.c != MIN)
+        {
+            key = {-key.a, -key.b, -key.c};
+        }
+        return key;
+    }
+
+    /**
+     * @brief Turns a solution of the normalized triplet into the solution of the original one.
+     *
+     * Negating all coefficients keeps the roots, but (-b + sqrt(D)) / 2a becomes the second
+     * root, so two roots are swapped back. Negation is exact, except for the sign of zero
+     * roots, which is restored the way direct solving produces it: +0 / 2a for two roots,
+     * -0 / b for a linear root and -0 / 2a for a single root.
+     *
+     * @param t Original triplet.
+     * @param key Its normalized key.
+     * @param solution Solution of the normalized triplet.
+     */
+    inline utils::types::EquationSolution orient(const utils::types::Triplet& t, const NormalizedKey& key,
+                                                 utils::types::EquationSolution solution) noexcept
+    {
+        using utils::types::SolveCase;
+
+        const auto leading{t.a != 0 ? t.a : (t.b != 0 ? t.b : t.c)};
+        const auto keyLeading{key.a != 0 ? key.a : (key.b != 0 ? key.b : key.c)};
+        if ((leading < 0) == (keyLeading < 0))
+        {
+            return solution;
+        }
+
+        auto signZero = [](double& root, int64_t sign)
+        {
+            if (root == 0.0)
+            {
+                root = std::copysign(0.0, static_cast<double>(sign));
+            }
+        };
+
+        switch (solution.kind)
+        {
+        case SolveCase::TwoRoots:
+            std::swap(solution.x1, solution.x2);
+            signZero(solution.x1, t.a);
+            signZero(solution.x2, t.a);
+            break;
+
+        case SolveCase::Linear:
+            signZero(solution.x1, t.b < 0 ? 1 : -1);
+            break;
+
+        case SolveCase::SingleRoot:
+            signZero(solution.x1, t.a < 0 ? 1 : -1);
+            break;
+
+        default:
+            break;
+        }
+        return solution;
+    }
+
+    /**
+     * @class SolutionCache
+     * @brief Bounded concurrent cache of equation solutions keyed by normalized triplets.
+     *
+     * Entries are split into shards, each guarded by its own mutex, so resolver threads
+     * rarely contend. Every shard is a set-associative table allocated up front: a key
+     * maps to a set of WAYS entries and evicts the least recently used one of that set,
+     * so memory stays bounded and lookups never allocate.
+     */
+    class SolutionCache
+    {
+    public:
+        static constexpr std::size_t DEFAULT_SHARD_COUNT{64};
+        static constexpr std::size_t WAYS{4};
+
+        /**
+         * @brief Allocates the cache.
+         *
+         * @param capacity Maximum number of cached solutions, rounded up to whole sets.
+         * @param shardCount Number of independently locked shards.
+         */
+        explicit SolutionCache(std::size_t capacity, std::size_t shardCount = DEFAULT_SHARD_COUNT) :
+            m_shardCount(std::max<std::size_t>(shardCount, 1)),
+            m_setCount(std::max<std::size_t>((capacity + m_shardCount * WAYS - 1) / (m_shardCount * WAYS), 1)),
+            m_shards(std::make_unique<Shard[]>(m_shardCount))
+        {
+            for (std::size_t i = 0; i < m_shardCount; ++i)
+            {
+                m_shards[i].entries = std::make_unique<Entry[]>(m_setCount * WAYS);
+            }
+        }
+
+        ~SolutionCache() = default;
+        SolutionCache(const SolutionCache&) = delete;
+        SolutionCache& operator=(const SolutionCache&) = delete;
+        SolutionCache(SolutionCache&&) = delete;
+        SolutionCache& operator=(SolutionCache&&) = delete;
+
+        /**
+         * @brief Looks up a solution.
+         *
+         * @param key Normalized triplet.
+         * @param out Receives the cached solution on hit.
+         * @return true on hit.
+         */
+        bool find(const NormalizedKey& key, utils::types::EquationSolution& out)
+        {
+            const auto hash{_hash(key)};
+            auto& shard{_shard(hash)};
+
+            std::lock_guard lock(shard.mutex);
+            Entry* set{_set(shard, hash)};
+            for (std::size_t way = 0; way < WAYS; ++way)
+            {
+                if (set[way].used != 0 && set[way].key == key)
+                {
+                    set[way].used = ++shard.clock;
+                    out = set[way].solution;
+                    ++shard.hits;
+                    return true;
+                }
+            }
+            ++shard.misses;
+            return false;
+        }
+
+        /**
+         * @brief Stores a solution, evicting the least recently used entry of its set if needed.
+         */
+        void insert(const NormalizedKey& key, const utils::types::EquationSolution& solution)
+        {
+            const auto hash{_hash(key)};
+            auto& shard{_shard(hash)};
+
+            std::lock_guard lock(shard.mutex);
+            Entry* set{_set(shard, hash)};
+            Entry* victim{set};
+            for (std::size_t way = 0; way < WAYS; ++way)
+            {
+                // another resolver may have inserted the same key meanwhile
+                if (set[way].used != 0 && set[way].key == key)
+                {
+                    victim = &set[way];
+                    break;
+                }
+                if (set[way].used < victim->used)
+                {
+                    victim = &set[way];
+                }
+            }
+            *victim = {key, solution, ++shard.clock};
+        }
+
+        /**
+         * @brief Number of entries the cache can hold.
+         */
+        [[nodiscard]] std::size_t capacity() const noexcept
+        {
+            return m_shardCount * m_setCount * WAYS;
+        }
+
+        [[nodiscard]] uint64_t hits() const
+        {
+            return _sum(&Shard::hits);
+        }
+
+        [[nodiscard]] uint64_t misses() const
+        {
+            return _sum(&Shard::misses);
+        }
+
+    private:
+        struct Entry
+        {
+            NormalizedKey key{};
+            utils::types::EquationSolution solution{};
+            uint64_t used{0}; // last access tick, 0 for empty entries
+        };
+
+        struct alignas(utils::constants::CACHE_SIZE) Shard
+        {
+            mutable std::mutex mutex{};
+            std::unique_ptr<Entry[]> entries{};
+            uint64_t clock{0};
+            uint64_t hits{0};
+            uint64_t misses{0};
+        };
+
+        static uint64_t _hash(const NormalizedKey& key) noexcept
+        {
+            // splitmix64 finalizer over a multiplicative combination
+            auto hash{static_cast<uint64_t>(key.a) * 0x9E3779B97F4A7C15ull};
+            hash ^= static_cast<uint64_t>(key.b) + 0xBF58476D1CE4E5B9ull + (hash << 6) + (hash >> 2);
+            hash ^= static_cast<uint64_t>(key.c) + 0x94D049BB133111EBull + (hash << 6) + (hash >> 2);
+            hash ^= hash >> 30;
+            hash *= 0xBF58476D1CE4E5B9ull;
+            hash ^= hash >> 27;
+            hash *= 0x94D049BB133111EBull;
+            return hash ^ (hash >> 31);
+        }
+
+        Shard& _shard(uint64_t hash) noexcept
+        {
+            return m_shards[(hash >> 32) % m_shardCount];
+        }
+
+        Entry* _set(Shard& shard, uint64_t hash) const noexcept
+        {
+            return shard.entries.get() + (hash & 0xFFFFFFFFull) % m_setCount * WAYS;
+        }
+
+        uint64_t _sum(uint64_t Shard::* counter) const
+        {
+            uint64_t total{0};
+            for (std::size_t i = 0; i < m_shardCount; ++i)
+            {
+                std::lock_guard lock(m_shards[i].mutex);
+                total += m_shards[i].*counter;
+            }
+            return total;
+        }
+
+        const std::size_t m_shardCount;
+        const std::size_t m_setCount;
+        std::unique_ptr<Shard[]> m_shards;
+    };
+}
+
+#endif //SOLUTION_CACHE_H
@@ -1,10 +1,12 @@
 #include "cli_parser.h"
+#include "triplet_tokens.h"
+#include "stats/stats.h"
+#include "thread/cpu_topology.h"
 
 #include <array>
-#include <sstream>
-#include <cstring>
-#include <iostream>
+#include <string>
 #include <charconv>
+#include <stdexcept>
 #include <string_view>
 
 
@@ -12,6 +14,132 @@ namespace tektask::cli_parser
 {
     using namespace tektask::utils::types;
 
+    namespace
+    {
+        constexpr std::string_view INPUT_OPTION{"--input"};
+        constexpr std::string_view INPUT_FORMAT_OPTION{"--input-format"};
+        constexpr std::string_view QUEUE_OPTION{"--queue"};
+        constexpr std::string_view CACHE_OPTION{"--cache"};
+        constexpr std::string_view STATS_OPTION{"--stats"};
+        constexpr std::string_view STATS_JSON_OPTION{"--stats-json"};
+        constexpr std::string_view THREADS_OPTION{"--threads"};
+        constexpr std::string_view CPUS_OPTION{"--cpus"};
+        constexpr std::string_view SERVE_OPTION{"--serve"};
+        constexpr std::string_view OUTPUT_OPTION{"--output"};
+        constexpr std::string_view OUTPUT_FORMAT_OPTION{"--output-format"};
+        constexpr std::string_view PLAN_OPTION{"--plan"};
+        constexpr std::string_view PLANNER_CONFIG_OPTION{"--planner-config"};
+        constexpr std::string_view CALIBRATE_OPTION{"--calibrate"};
+        constexpr std::string_view AGGREGATE_OPTION{"--aggregate"};
+
+        /**
+         * @brief Returns value of the option at argv[index], advancing index past the value.
+         *
+         * @throws if the option value is missing.
+         */
+        std::string_view optionValue(int argc, const char* argv[], int& index)
+        {
+            if (index + 1 >= argc)
+            {
+                throw std::invalid_argument("Invalid input: missing value for " + std::string{argv[index]} + " option");
+            }
+            return argv[++index];
+        }
+
+        InputFormat parseInputFormat(std::string_view value)
+        {
+            if (value == "text")
+            {
+                return InputFormat::Text;
+            }
+            if (value == "binary")
+            {
+                return InputFormat::Binary;
+            }
+            throw std::invalid_argument("Invalid input: unknown input format " + std::string{value});
+        }
+
+        OutputFormat parseOutputFormat(std::string_view value)
+        {
+            if (value == "text")
+            {
+                return OutputFormat::Text;
+            }
+            if (value == "binary")
+            {
+                return OutputFormat::Binary;
+            }
+            throw std::invalid_argument("Invalid input: unknown output format " + std::string{value});
+        }
+
+        QueueKind parseQueueKind(std::string_view value)
+        {
+            if (value == "blocking")
+            {
+                return QueueKind::Blocking;
+            }
+            if (value == "lockfree")
+            {
+                return QueueKind::LockFree;
+            }
+            if (value == "stealing")
+            {
+                return QueueKind::WorkStealing;
+            }
+            throw std::invalid_argument("Invalid input: unknown queue " + std::string{value});
+        }
+
+        ExecutionMode parseExecutionMode(std::string_view value)
+        {
+            if (value == "auto")
+            {
+                return ExecutionMode::Auto;
+            }
+            if (value == "serial")
+            {
+                return ExecutionMode::Serial;
+            }
+            if (value == "parallel")
+            {
+                return ExecutionMode::Parallel;
+            }
+            throw std::invalid_argument("Invalid input: unknown plan " + std::string{value});
+        }
+
+        std::size_t parseCacheSize(std::string_view value)
+        {
+            std::size_t size{0};
+            const char* end{value.data() + value.size()};
+            const auto result{std::from_chars(value.data(), end, size)};
+            if (value.empty() || result.ec != std::errc{} || result.ptr != end)
+            {
+                throw std::invalid_argument("Invalid input: invalid cache size " + std::string{value});
+            }
+            return size;
+        }
+
+        uint32_t parseThreadCount(std::string_view value)
+        {
+            uint32_t count{0};
+            const char* end{value.data() + value.size()};
+            const auto result{std::from_chars(value.data(), end, count)};
+            if (value.empty() || result.ec != std::errc{} || result.ptr != end || count == 0)
+            {
+                throw std::invalid_argument("Invalid input: invalid thread count " + std::string{value});
+            }
+            return count;
+        }
+
+        std::vector<int> parseCpus(std::string_view value)
+        {
+            if (value == "all")
+            {
+                return thread::CpuTopology::detect().allowedCpus();
+            }
+            return thread::parseCpuList(value);
+        }
+    }
+
     [[nodiscard]] CliArgs CliParser::parse(int argc, const char* argv[])
     {
         const auto argsLen{argc - 1};
@@ -20,57 +148,192 @@ namespace tektask::cli_parser
             throw std::invalid_argument("Invalid input: missing command line arguments");
         }
 
+        // split options from positional coefficients, keep program name as the first element
+        CliArgs args{};
+        std::vector<const char*> positional{argv[0]};
+        positional.reserve(argc);
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg{argv[i]};
+            if (arg == INPUT_OPTION)
+            {
+                args.inputPath = optionValue(argc, argv, i);
+            }
+            else if (arg == INPUT_FORMAT_OPTION)
+            {
+                args.inputFormat = parseInputFormat(optionValue(argc, argv, i));
+            }
+            else if (arg == QUEUE_OPTION)
+            {
+                args.queueKind = parseQueueKind(optionValue(argc, argv, i));
+            }
+            else if (arg == CACHE_OPTION)
+            {
+                args.cacheSize = parseCacheSize(optionValue(argc, argv, i));
+            }
+            else if (arg == STATS_OPTION)
+            {
+                args.printStats = true;
+            }
+            else if (arg == STATS_JSON_OPTION)
+            {
+                args.statsJsonPath = optionValue(argc, argv, i);
+            }
+            else if (arg == THREADS_OPTION)
+            {
+                args.threadCount = parseThreadCount(optionValue(argc, argv, i));
+                m_threadCount = args.threadCount;
+            }
+            else if (arg == CPUS_OPTION)
+            {
+                args.cpus = parseCpus(optionValue(argc, argv, i));
+            }
+            else if (arg == SERVE_OPTION)
+            {
+                args.socketPath = optionValue(argc, argv, i);
+            }
+            else if (arg == OUTPUT_OPTION)
+            {
+                args.outputPath = optionValue(argc, argv, i);
+            }
+            else if (arg == OUTPUT_FORMAT_OPTION)
+            {
+                args.outputFormat = parseOutputFormat(optionValue(argc, argv, i));
+            }
+            else if (arg == PLAN_OPTION)
+            {
+                args.executionMode = parseExecutionMode(optionValue(argc, argv, i));
+            }
+            else if (arg == PLANNER_CONFIG_OPTION)
+            {
+                args.plannerConfigPath = optionValue(argc, argv, i);
+            }
+            else if (arg == CALIBRATE_OPTION)
+            {
+                args.calibrate = true;
+            }
+            else if (arg == AGGREGATE_OPTION)
+            {
+                args.aggregate = true;
+            }
+            else
+            {
+                positional.emplace_back(argv[i]);
+            }
+        }
+
+        if (args.inputFormat == InputFormat::Binary && (args.inputPath.empty() || args.inputPath == "-"))
+        {
+            throw std::invalid_argument("Invalid input: binary input format requires --input file path");
+        }
+
+        if (args.outputFormat == OutputFormat::Binary && (args.outputPath.empty() || args.outputPath == "-"))
+        {
+            throw std::invalid_argument("Invalid input: binary output format requires --output file path");
+        }
+
+        if (args.aggregate && (args.outputFormat == OutputFormat::Binary || !args.socketPath.empty()))
+        {
+            throw std::invalid_argument("Invalid input: --aggregate requires text output of a single job");
+        }
+
+        if (args.calibrate)
+        {
+            if (positional.size() > 1 || !args.inputPath.empty() || !args.socketPath.empty())
+            {
+                throw std::invalid_argument("Invalid input: --calibrate can't be combined with input");
+            }
+            return args;
+        }
+
+        if (!args.socketPath.empty())
+        {
+            if (positional.size() > 1 || !args.inputPath.empty())
+            {
+                throw std::invalid_argument("Invalid input: --serve can't be combined with input");
+            }
+            return args;
+        }
+
+        if (!args.inputPath.empty())
+        {
+            if (positional.size() > 1)
+            {
+                throw std::invalid_argument("Invalid input: --input can't be combined with command line coefficients");
+            }
+            return args;
+        }
+
+        const auto count{static_cast<int>(positional.size())};
+        args.triplets = _parseTriplets(count, positional.data(), args.rejected);
+        return args;
+    }
+
+    std::vector<Triplet> CliParser::_parseTriplets(int argc, const char* argv[], std::vector<int64_t>& rejected)
+    {
+        stats::ScopedTimer timer{stats::Stage::Parse};
+
+        // split triplet starts into aligned parts, every part ends before the next part's first triplet
+        const auto tripletCount{(argc + 1) / 3};
+        const auto partCount{
+            static_cast<std::size_t>(std::clamp<int32_t>(tripletCount / MIN_PART_TRIPLETS, 1,
+                                                         static_cast<int32_t>(m_threadCount)))
+        };
+
+        // arguments are parsed once, before the pool is sized by them, so parts get their own threads
+        std::vector<ParsedPart> parts(partCount);
+        thread::runParts(partCount, [&](std::size_t i)
+        {
+            const auto first{static_cast<int32_t>(tripletCount * i / partCount)};
+            const auto last{static_cast<int32_t>(tripletCount * (i + 1) / partCount)};
+            _parsePart(argc, argv, 1 + first * 3, 1 + last * 3, parts[i]);
+        });
+
         std::vector<Triplet> triplets;
-        triplets.reserve(1 + argsLen / 3);
+        triplets.reserve(1 + (argc - 1) / 3);
+        int64_t nextId{0};
+        mergeParts(parts, triplets, nextId, rejected);
 
-        for (int i = 1; i < argc; i += 3)
+        if (triplets.empty())
+        {
+            throw std::invalid_argument("Invalid input: no valid parameters");
+        }
+        return triplets;
+    }
+
+    void CliParser::_parsePart(int argc, const char* argv[], int32_t first, int32_t last, ParsedPart& part)
+    {
+        for (int i = first; i < last && i < argc; i += 3)
         {
             // validate proper length to create Triplet
             if (i + 2 >= argc)
             {
-                _processInvalidTriplet(argv, i, argc, "Invalid input: parameter count must be a multiple of 3!");
+                part.rejected.push_back(part.triplets.size());
+                _processInvalidTriplet(argv, i, argc, INVALID_TRIPLET_SIZE_MESSAGE, part.diagnostics);
                 break;
             }
 
             auto triplet{_parseTriplet(argv, i)};
             if (triplet.has_value())
             {
-                triplets.emplace_back(triplet.value());
+                part.triplets.emplace_back(triplet.value());
                 continue;
             }
 
-            _processInvalidTriplet(argv, i, i + 3, "Invalid input: failed to parse triplet");
-        }
-
-        if (triplets.empty())
-        {
-            throw std::invalid_argument("Invalid input: no valid parameters");
+            part.rejected.push_back(part.triplets.size());
+            _processInvalidTriplet(argv, i, i + 3, INVALID_TRIPLET_MESSAGE, part.diagnostics);
         }
-        return {
-            std::move(triplets),
-        };
     }
 
     void CliParser::_processInvalidTriplet(const char* argv[], int32_t start, int32_t end,
-                                           std::string_view message) noexcept
+                                           std::string_view message, std::string& diagnostics)
     {
         std::array<std::string_view, 3> visited;
         for (int i = start; i < end; ++i)
         {
             visited[i - start] = argv[i];
         }
-
-        std::stringstream stream;
-        stream << "(";
-        std::string separator;
-        for (const auto& str : visited)
-        {
-            stream << separator << str;
-            separator = ",";
-        }
-
-        stream << ") => " << message;
-        std::cout << stream.str() << std::endl;
+        appendInvalidTriplet(diagnostics, visited, message);
     }
 
     std::optional<Triplet> CliParser::_parseTriplet(const char* argv[], int32_t start) noexcept
@@ -78,14 +341,7 @@ namespace tektask::cli_parser
         Triplet tmp{};
         auto stoi = [](const char* str, auto& out)
         {
-            if (!str || std::strlen(str) == 0)
-            {
-                return false;
-            }
-
-            const char* end = str + std::strlen(str);
-            std::from_chars_result result = std::from_chars(str, end, out);
-            return result.ec == std::errc{} && result.ptr == end;
+            return str && parseCoefficient(str, out);
         };
 
         bool parsed{true};
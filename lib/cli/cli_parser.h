@@ -1,9 +1,11 @@
 #ifndef CLI_PARSER_H
 #define CLI_PARSER_H
 
+#include "cli/parallel_parse.h"
 #include "utils/types/types.h"
 
 #include <optional>
+#include <algorithm>
 
 
 namespace tektask::cli_parser
@@ -18,7 +20,19 @@ namespace tektask::cli_parser
     class CliParser
     {
     public:
-        CliParser() = default;
+        // smaller argument lists are not worth a separate thread
+        static constexpr int32_t MIN_PART_TRIPLETS{4 * 1024};
+
+        /**
+         * @brief Constructs a parser.
+         *
+         * @param threadCount Number of threads parsing positional coefficients, the calling thread included.
+         */
+        explicit CliParser(uint32_t threadCount = 1) :
+            m_threadCount(std::max<uint32_t>(threadCount, 1))
+        {
+        }
+
         CliParser(const CliParser&) = delete;
         CliParser(CliParser&&) = delete;
         CliParser& operator=(const CliParser&) = delete;
@@ -30,25 +44,77 @@ namespace tektask::cli_parser
          *
          * Expects input in form of triplets, like 1, 2, 3, ...
          * Filters garbage triplet sequence or with invalid size.
+         * Valid triplets get sequential ids in input order.
+         *
+         * Alternatively "--input <path|->" option selects a file or stdin as
+         * the triplets source, in that case triplets are left empty and
+         * the input is expected to be parsed by StreamParser.
+         * "--input-format text|binary" option selects the input file format,
+         * binary files are memory mapped, so they require a file path.
+         * "--queue blocking|lockfree|stealing" option selects resolver input queue implementation.
+         * "--cache <entries>" option enables the solution cache for repeated and power of two scaled triplets.
+         * "--stats" option prints per-stage statistics to stderr at exit,
+         * "--stats-json <path>" writes them as JSON.
+         * "--threads <count>" sets the number of pipeline threads, positional
+         * coefficients are parsed with that many threads too.
+         * "--cpus <list|mask|all>" pins pipeline threads to the given CPUs,
+         * like "0-3,8" or "0xff".
+         * "--output-format text|binary" selects the results format, "--output <path>"
+         * writes results into a file instead of stdout, binary results require it.
+         * "--serve <socket>" runs the solver as a daemon on the Unix domain socket,
+         * requests come from clients, so no input is expected.
+         * "--plan auto|serial|parallel" overrides the execution plan the planner picks by input size,
+         * "--planner-config <path>" selects the planner thresholds file, "--calibrate" measures
+         * the thresholds on this machine and writes them there, no input is expected either.
+         * "--aggregate" prints summary statistics of the solutions instead of every result,
+         * it requires text output and can't be combined with "--serve".
          *
          * @param argc Number of command-line arguments.
          * @param argv Array of command-line arguments.
          * @return CliArgs structure with valid triplets for further processing.
          *
-         * @throws if no valid triplets.
+         * @throws if no valid triplets or options are malformed.
          */
         [[nodiscard]] utils::types::CliArgs parse(int argc, const char* argv[]);
 
     private:
         /**
-         * @brief Prints an invalid triplet with a custom error message.
+         * @brief Parses positional arguments into triplets.
+         *
+         * Long argument lists are split into triplet aligned parts parsed in parallel,
+         * diagnostics are printed in input order.
+         *
+         * @param argc Number of positional arguments, including program name.
+         * @param argv Array of positional arguments, including program name.
+         * @param rejected Ids of the valid triplets following every rejected one.
+         * @return Valid triplets in input order.
+         *
+         * @throws if no valid triplets.
+         */
+        std::vector<utils::types::Triplet> _parseTriplets(int argc, const char* argv[], std::vector<int64_t>& rejected);
+
+        /**
+         * @brief Parses triplets starting in the given argument range.
+         *
+         * @param argc Number of positional arguments, including program name.
+         * @param argv Array of positional arguments, including program name.
+         * @param first Index of the first triplet element of the part.
+         * @param last Index after the last triplet start of the part.
+         * @param part Storage for valid triplets and diagnostics.
+         */
+        void _parsePart(int argc, const char* argv[], int32_t first, int32_t last, ParsedPart& part);
+
+        /**
+         * @brief Collects an invalid triplet report with a custom error message.
          *
          * @param argv Argument array.
          * @param start Index of the first triplet element.
          * @param end Index after the last element.
-         * @param message Error message to be printed.
+         * @param message Error message to be reported.
+         * @param diagnostics Text buffer, the report line is appended to it.
          */
-        void _processInvalidTriplet(const char* argv[], int32_t start, int32_t end, std::string_view message) noexcept;
+        void _processInvalidTriplet(const char* argv[], int32_t start, int32_t end, std::string_view message,
+                                    std::string& diagnostics);
 
         /**
          * @brief Attempts to parse a valid len triplet starting from a given index.
@@ -61,6 +127,8 @@ namespace tektask::cli_parser
          * @return Triplet structure on success or std::nullopt if parsing failed.
          */
         std::optional<utils::types::Triplet> _parseTriplet(const char* argv[], int32_t start) noexcept;
+
+        uint32_t m_threadCount{1};
     };
 }
 
@@ -0,0 +1,70 @@
+#ifndef PARALLEL_PARSE_H
+#define PARALLEL_PARSE_H
+
+#include "cli/triplet_tokens.h"
+#include "stats/stats.h"
+#include "thread/thread_pool.h"
+#include "utils/types/types.h"
+
+#include <string>
+#include <vector>
+
+
+namespace tektask::cli_parser
+{
+    /**
+     * @brief Result of parsing a single input part, kept until all parts are done.
+     */
+    struct ParsedPart
+    {
+        std::vector<utils::types::Triplet> triplets{};
+        std::string diagnostics{};
+        // number of valid triplets of the part in front of every rejected one
+        std::vector<std::size_t> rejected{};
+    };
+
+    /**
+     * @brief Merges parsed parts in input order.
+     *
+     * Diagnostics are printed, or collected, part by part, so they keep input order,
+     * triplets get sequential ids continuing from nextId, every part takes the id
+     * range right after the previous one.
+     *
+     * @param parts Parsed parts in input order, left empty for reuse.
+     * @param out Storage to append valid triplets to.
+     * @param nextId Id of the first triplet, advanced past the last one.
+     * @param rejected Storage to append, for every rejected triplet, the id of the valid triplet following it.
+     * @param diagnostics Text buffer to append diagnostics to, they are printed if nullptr.
+     */
+    inline void mergeParts(std::vector<ParsedPart>& parts, std::vector<utils::types::Triplet>& out, int64_t& nextId,
+                           std::vector<int64_t>& rejected, std::string* diagnostics = nullptr)
+    {
+        for (auto& part : parts)
+        {
+            for (const auto before : part.rejected)
+            {
+                rejected.push_back(nextId + static_cast<int64_t>(before));
+            }
+
+            stats::count(stats::Counter::ParsedTriplets, part.triplets.size());
+            if (diagnostics != nullptr)
+            {
+                diagnostics->append(part.diagnostics);
+            }
+            else
+            {
+                printDiagnostics(part.diagnostics);
+            }
+            for (auto& triplet : part.triplets)
+            {
+                triplet.id = nextId++;
+                out.emplace_back(triplet);
+            }
+            part.diagnostics.clear();
+            part.triplets.clear();
+            part.rejected.clear();
+        }
+    }
+}
+
+#endif //PARALLEL_PARSE_H
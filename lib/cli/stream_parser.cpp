@@ -0,0 +1,241 @@
+#include "stream_parser.h"
+#include "triplet_tokens.h"
+#include "token_scanner.h"
+#include "stats/stats.h"
+
+#include <array>
+#include <cstring>
+#include <limits>
+#include <algorithm>
+
+
+namespace tektask::cli_parser
+{
+    using namespace tektask::utils::types;
+
+    namespace
+    {
+        std::size_t countTokens(const char* data, std::size_t pos, std::size_t limit) noexcept
+        {
+            TokenScanner scanner{data, pos, limit};
+            std::size_t count{0};
+            while (!scanner.next().empty())
+            {
+                ++count;
+            }
+            return count;
+        }
+
+        /**
+         * @brief Where part parsing stopped, incomplete means the last triplet ran out of tokens.
+         */
+        struct PartEnd
+        {
+            std::size_t stop{0};
+            bool incomplete{false};
+        };
+
+        /**
+         * @brief Parses up to maxTriplets triplets starting after skipTokens tokens from pos.
+         *
+         * Triplets may take tokens from the following parts, up to limit.
+         * An incomplete trailing triplet is reported only at the end of input.
+         */
+        PartEnd parsePart(const char* data, std::size_t pos, std::size_t limit, std::size_t skipTokens,
+                          std::size_t maxTriplets, bool eof, ParsedPart& part)
+        {
+            TokenScanner scanner{data, pos, limit};
+            for (; skipTokens > 0; --skipTokens)
+            {
+                if (scanner.next().empty())
+                {
+                    return {limit, false};
+                }
+            }
+
+            for (std::size_t parsedTriplets = 0; parsedTriplets < maxTriplets; ++parsedTriplets)
+            {
+                const auto start{scanner.position()};
+                std::array<std::string_view, 3> tokens{};
+                std::size_t count{0};
+                while (count < tokens.size() && !(tokens[count] = scanner.next()).empty())
+                {
+                    ++count;
+                }
+
+                if (count < tokens.size())
+                {
+                    if (count == 0)
+                    {
+                        return {limit, false};
+                    }
+                    if (eof)
+                    {
+                        part.rejected.push_back(part.triplets.size());
+                        appendInvalidTriplet(part.diagnostics, tokens, INVALID_TRIPLET_SIZE_MESSAGE);
+                        return {limit, true};
+                    }
+                    return {start, true};
+                }
+
+                Triplet triplet{};
+                bool parsed{true};
+                parsed &= parseCoefficient(tokens[0], triplet.a);
+                parsed &= parseCoefficient(tokens[1], triplet.b);
+                parsed &= parseCoefficient(tokens[2], triplet.c);
+                if (!parsed)
+                {
+                    part.rejected.push_back(part.triplets.size());
+                    appendInvalidTriplet(part.diagnostics, tokens, INVALID_TRIPLET_MESSAGE);
+                    continue;
+                }
+                part.triplets.emplace_back(triplet);
+            }
+            return {scanner.position(), false};
+        }
+    }
+
+    StreamParser::StreamParser(std::istream& input, std::size_t chunkSize, uint32_t threadCount,
+                               std::string* diagnostics, thread::ThreadPool* pool) :
+        m_input(input),
+        m_buffer(std::max<std::size_t>(chunkSize, 1) * std::max<uint32_t>(threadCount, 1)),
+        m_threadCount(std::max<uint32_t>(threadCount, 1)),
+        m_diagnostics(diagnostics),
+        m_pool(pool)
+    {
+    }
+
+    bool StreamParser::next(std::vector<Triplet>& out)
+    {
+        stats::ScopedTimer timer{stats::Stage::Parse};
+        out.clear();
+        m_rejected.clear();
+        while (out.empty())
+        {
+            if (!_fill())
+            {
+                return false;
+            }
+            _parseBuffered(out);
+        }
+        return true;
+    }
+
+    std::size_t StreamParser::parsedCount() const noexcept
+    {
+        return static_cast<std::size_t>(m_nextId);
+    }
+
+    bool StreamParser::_fill()
+    {
+        if (m_eof)
+        {
+            return m_begin < m_end;
+        }
+
+        // keep unparsed tail, grow the buffer if a single triplet doesn't fit into it
+        const auto tail{m_end - m_begin};
+        if (m_begin > 0)
+        {
+            std::memmove(m_buffer.data(), m_buffer.data() + m_begin, tail);
+        }
+        m_begin = 0;
+        m_end = tail;
+        if (m_end == m_buffer.size())
+        {
+            m_buffer.resize(m_buffer.size() * 2);
+        }
+
+        m_input.read(m_buffer.data() + m_end, static_cast<std::streamsize>(m_buffer.size() - m_end));
+        m_end += static_cast<std::size_t>(m_input.gcount());
+        m_eof = !m_input;
+        return true;
+    }
+
+    void StreamParser::_parseBuffered(std::vector<Triplet>& out)
+    {
+        const char* data{m_buffer.data()};
+
+        // the last token may continue in the next chunk
+        auto limit{m_end};
+        if (!m_eof)
+        {
+            while (limit > m_begin && !isSpace(data[limit - 1]))
+            {
+                --limit;
+            }
+        }
+
+        _planParts(limit);
+        m_parts.resize(m_plans.size());
+        std::vector<PartEnd> ends(m_plans.size());
+        thread::runParts(m_plans.size(), [&](std::size_t i)
+        {
+            const auto& plan{m_plans[i]};
+            ends[i] = parsePart(data, plan.begin, limit, plan.skipTokens, plan.maxTriplets, m_eof, m_parts[i]);
+        }, m_pool);
+        mergeParts(m_parts, out, m_nextId, m_rejected, m_diagnostics);
+
+        // keep the incomplete triplet for the next chunk
+        m_begin = limit;
+        for (const auto& end : ends)
+        {
+            if (end.incomplete)
+            {
+                m_begin = end.stop;
+                break;
+            }
+        }
+    }
+
+    void StreamParser::_planParts(std::size_t limit)
+    {
+        const char* data{m_buffer.data()};
+        const auto length{limit - m_begin};
+        const auto partCount{std::clamp<std::size_t>(length / MIN_PART_SIZE, 1, m_threadCount)};
+
+        // part bounds are moved forward to whitespace, so tokens never straddle parts
+        m_plans.assign(partCount, {});
+        auto begin{m_begin};
+        for (std::size_t i = 0; i < partCount; ++i)
+        {
+            auto end{i + 1 == partCount ? limit : std::max(begin, m_begin + length * (i + 1) / partCount)};
+            while (end < limit && !isSpace(data[end]))
+            {
+                ++end;
+            }
+            m_plans[i].begin = begin;
+            m_plans[i].end = end;
+            begin = end;
+        }
+
+        m_plans.back().maxTriplets = std::numeric_limits<std::size_t>::max();
+        if (partCount == 1)
+        {
+            return;
+        }
+
+        // token counts of preceding parts give triplet alignment of every part, the last count isn't needed
+        std::vector<std::size_t> counts(partCount - 1);
+        thread::runParts(counts.size(), [&](std::size_t i)
+        {
+            counts[i] = countTokens(data, m_plans[i].begin, m_plans[i].end);
+        }, m_pool);
+
+        std::size_t before{0};
+        for (std::size_t i = 0; i < partCount; ++i)
+        {
+            auto& plan{m_plans[i]};
+            plan.skipTokens = (3 - before % 3) % 3;
+            if (i + 1 == partCount)
+            {
+                break;
+            }
+
+            const auto first{before + plan.skipTokens};
+            const auto last{before + counts[i]};
+            plan.maxTriplets = first < last ? (last - first + 2) / 3 : 0;
+            before = last;
+        }
+    }
+}
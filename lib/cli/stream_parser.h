@@ -0,0 +1,127 @@
+#ifndef STREAM_PARSER_H
+#define STREAM_PARSER_H
+
+#include "cli/parallel_parse.h"
+#include "utils/types/types.h"
+
+#include <istream>
+
+
+namespace tektask::cli_parser
+{
+    /**
+     * @class StreamParser
+     * @brief Chunked triplets parser for file or stdin input.
+     *
+     * Reads whitespace/newline separated coefficients from the input stream
+     * chunk by chunk, so the whole input never has to be kept in memory.
+     * Validation rules and invalid triplets reporting are the same as in CliParser,
+     * valid triplets get sequential ids in input order.
+     *
+     * With several threads every chunk is split into whitespace aligned parts,
+     * parsed in parallel and merged back in input order, diagnostics included.
+     */
+    class StreamParser
+    {
+    public:
+        static constexpr std::size_t DEFAULT_CHUNK_SIZE{64 * 1024};
+
+        // smaller parts are not worth a separate thread
+        static constexpr std::size_t MIN_PART_SIZE{4 * 1024};
+
+        /**
+         * @brief Constructs a parser on top of the input stream.
+         *
+         * @param input The stream to read coefficients from.
+         * @param chunkSize Read buffer size in bytes per parsing thread, grows if a single triplet doesn't fit.
+         * @param threadCount Number of parsing threads, the calling thread included.
+         * @param diagnostics Text buffer collecting invalid triplet reports, they are printed if nullptr.
+         * @param pool Idle workers parsing the other parts of every chunk, threads are started per chunk if nullptr.
+         */
+        explicit StreamParser(std::istream& input, std::size_t chunkSize = DEFAULT_CHUNK_SIZE,
+                              uint32_t threadCount = 1, std::string* diagnostics = nullptr,
+                              thread::ThreadPool* pool = nullptr);
+
+        StreamParser(const StreamParser&) = delete;
+        StreamParser(StreamParser&&) = delete;
+        StreamParser& operator=(const StreamParser&) = delete;
+        StreamParser& operator=(StreamParser&&) = delete;
+        ~StreamParser() = default;
+
+        /**
+         * @brief Reads the next input chunk and parses all complete triplets from it.
+         *
+         * Invalid triplets are reported and skipped, an incomplete trailing triplet
+         * is reported when the input is exhausted.
+         *
+         * @param out Cleared and filled with valid triplets, ids are assigned sequentially.
+         * @return true if out contains triplets, false if the input is exhausted.
+         */
+        bool next(std::vector<utils::types::Triplet>& out);
+
+        /**
+         * @brief Number of valid triplets parsed so far.
+         */
+        [[nodiscard]] std::size_t parsedCount() const noexcept;
+
+        /**
+         * @brief Triplets rejected by the last next() call, as ids of the valid triplets following them.
+         *
+         * Rejected trailing triplets are followed by parsedCount(), they come with the final call,
+         * which returns false.
+         */
+        [[nodiscard]] const std::vector<int64_t>& rejected() const noexcept
+        {
+            return m_rejected;
+        }
+
+    private:
+        /**
+         * @brief Moves unparsed tail to the buffer beginning and reads more data.
+         *
+         * @return false if the input is exhausted and nothing is left to parse.
+         */
+        bool _fill();
+
+        /**
+         * @brief Parses all complete triplets available in the buffer.
+         *
+         * @param out Storage for valid triplets.
+         */
+        void _parseBuffered(std::vector<utils::types::Triplet>& out);
+
+        /**
+         * @brief Splits buffered bytes into whitespace aligned parts and finds where triplets of every part start.
+         *
+         * @param limit End of complete tokens in the buffer.
+         */
+        void _planParts(std::size_t limit);
+
+        /**
+         * @brief Part parsing plan, byte range, tokens which belong to the previous part's triplet
+         * and number of triplets starting in the part.
+         */
+        struct PartPlan
+        {
+            std::size_t begin{0};
+            std::size_t end{0};
+            std::size_t skipTokens{0};
+            std::size_t maxTriplets{0};
+        };
+
+        std::istream& m_input;
+        std::vector<char> m_buffer;
+        std::size_t m_begin{0};
+        std::size_t m_end{0};
+        bool m_eof{false};
+        int64_t m_nextId{0};
+        uint32_t m_threadCount{1};
+        std::vector<PartPlan> m_plans{};
+        std::vector<ParsedPart> m_parts{};
+        std::string* m_diagnostics{nullptr};
+        thread::ThreadPool* m_pool{nullptr};
+        std::vector<int64_t> m_rejected{};
+    };
+}
+
+#endif //STREAM_PARSER_H
@@ -0,0 +1,57 @@
+#include "token_scanner.h"
+
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define TEKTASK_X86_SCANNER 1
+#include <emmintrin.h>
+#endif
+
+
+namespace tektask::cli_parser
+{
+    uint64_t whitespaceMask(const char* block) noexcept
+    {
+#if defined(TEKTASK_X86_SCANNER)
+        // ' ' or '\t'..'\r': subtracting '\t' maps the control range to 0..4, saturating subtraction of 4 to 0
+        const __m128i space{_mm_set1_epi8(' ')};
+        const __m128i tab{_mm_set1_epi8('\t')};
+        const __m128i range{_mm_set1_epi8('\r' - '\t')};
+        const __m128i zero{_mm_setzero_si128()};
+
+        uint64_t mask{0};
+        for (std::size_t i = 0; i < TokenScanner::BLOCK_SIZE; i += sizeof(__m128i))
+        {
+            const __m128i bytes{_mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i))};
+            const __m128i control{_mm_cmpeq_epi8(_mm_subs_epu8(_mm_sub_epi8(bytes, tab), range), zero)};
+            const __m128i spaces{_mm_or_si128(_mm_cmpeq_epi8(bytes, space), control)};
+            mask |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(spaces))) << i;
+        }
+        return mask;
+#else
+        uint64_t mask{0};
+        for (std::size_t i = 0; i < TokenScanner::BLOCK_SIZE; ++i)
+        {
+            mask |= static_cast<uint64_t>(isSpace(block[i])) << i;
+        }
+        return mask;
+#endif
+    }
+
+    void TokenScanner::_load(std::size_t base) noexcept
+    {
+        m_base = base;
+        if (base + BLOCK_SIZE <= m_limit)
+        {
+            m_spaces = whitespaceMask(m_data + base);
+            return;
+        }
+
+        // the last partial block, padded with spaces
+        std::array<char, BLOCK_SIZE> padded{};
+        padded.fill(' ');
+        std::memcpy(padded.data(), m_data + base, m_limit - base);
+        m_spaces = whitespaceMask(padded.data());
+    }
+}
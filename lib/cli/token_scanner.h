@@ -0,0 +1,121 @@
+#ifndef TOKEN_SCANNER_H
+#define TOKEN_SCANNER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+
+namespace tektask::cli_parser
+{
+    /**
+     * @brief true for the whitespace characters separating tokens, the same set as std::isspace in "C" locale.
+     */
+    inline bool isSpace(char ch) noexcept
+    {
+        return ch == ' ' || static_cast<unsigned char>(ch - '\t') <= '\r' - '\t';
+    }
+
+    /**
+     * @brief Classifies 64 bytes at once.
+     *
+     * SSE2 on x86, scalar elsewhere.
+     *
+     * @param block Pointer to 64 readable bytes.
+     * @return Bit i is set if block[i] is whitespace.
+     */
+    uint64_t whitespaceMask(const char* block) noexcept;
+
+    /**
+     * @class TokenScanner
+     * @brief Splits a text range into whitespace separated tokens, 64 bytes per step.
+     *
+     * Every block is classified once into a whitespace bit mask, token bounds are
+     * then found with bit scans, so the scanner never loops over token characters.
+     * The last partial block is classified through a space padded copy, nothing
+     * is ever read past the limit.
+     */
+    class TokenScanner
+    {
+    public:
+        static constexpr std::size_t BLOCK_SIZE{64};
+
+        /**
+         * @brief Constructs a scanner over data[pos, limit).
+         */
+        TokenScanner(const char* data, std::size_t pos, std::size_t limit) noexcept :
+            m_data(data),
+            m_pos(pos),
+            m_limit(limit)
+        {
+            if (pos < limit)
+            {
+                _load(pos - pos % BLOCK_SIZE);
+            }
+        }
+
+        ~TokenScanner() = default;
+        TokenScanner(const TokenScanner&) = default;
+        TokenScanner& operator=(const TokenScanner&) = default;
+        TokenScanner(TokenScanner&&) noexcept = default;
+        TokenScanner& operator=(TokenScanner&&) noexcept = default;
+
+        /**
+         * @brief Returns the next token, advancing past it, or an empty view if there is none before the limit.
+         */
+        std::string_view next() noexcept
+        {
+            const auto begin{_find(m_pos, false)};
+            if (begin == m_limit)
+            {
+                m_pos = m_limit;
+                return {};
+            }
+
+            m_pos = _find(begin, true);
+            return {m_data + begin, m_pos - begin};
+        }
+
+        /**
+         * @brief Position right after the last returned token, the limit once tokens ran out.
+         */
+        [[nodiscard]] std::size_t position() const noexcept
+        {
+            return m_pos;
+        }
+
+    private:
+        /**
+         * @brief First position from pos on whose whitespace class matches, the limit if there is none.
+         */
+        std::size_t _find(std::size_t pos, bool space) noexcept
+        {
+            while (pos < m_limit)
+            {
+                if (pos - m_base >= BLOCK_SIZE)
+                {
+                    _load(pos - pos % BLOCK_SIZE);
+                }
+
+                const auto bits{(space ? m_spaces : ~m_spaces) >> (pos - m_base)};
+                if (bits != 0)
+                {
+                    const auto found{pos + static_cast<std::size_t>(__builtin_ctzll(bits))};
+                    return found < m_limit ? found : m_limit;
+                }
+                pos = m_base + BLOCK_SIZE;
+            }
+            return m_limit;
+        }
+
+        void _load(std::size_t base) noexcept;
+
+        const char* m_data{nullptr};
+        std::size_t m_pos{0};
+        std::size_t m_limit{0};
+        std::size_t m_base{0};
+        uint64_t m_spaces{~uint64_t{0}};
+    };
+}
+
+#endif //TOKEN_SCANNER_H
@@ -0,0 +1,59 @@
+#include "triplet_tokens.h"
+#include "stats/stats.h"
+#include "output/output_writer.h"
+
+#include <iostream>
+#include <charconv>
+
+
+namespace tektask::cli_parser
+{
+    bool detail::parseCoefficientSlow(std::string_view token, int64_t& out) noexcept
+    {
+        if (token.empty())
+        {
+            return false;
+        }
+
+        const char* end{token.data() + token.size()};
+        std::from_chars_result result{std::from_chars(token.data(), end, out)};
+        return result.ec == std::errc{} && result.ptr == end;
+    }
+
+    void appendInvalidTriplet(std::string& out, const std::array<std::string_view, 3>& tokens,
+                              std::string_view message)
+    {
+        stats::count(stats::Counter::InvalidTriplets);
+
+        out += '(';
+        std::string_view separator{};
+        for (const auto& str : tokens)
+        {
+            out += separator;
+            out += str;
+            separator = ",";
+        }
+
+        out += ") => ";
+        out += message;
+        out += '\n';
+    }
+
+    void printDiagnostics(std::string_view text) noexcept
+    {
+        // single write per batch, between lines of the ordered result writer
+        if (!text.empty())
+        {
+            std::lock_guard lock{output::outputMutex()};
+            std::cout.write(text.data(), static_cast<std::streamsize>(text.size()));
+            std::cout.flush();
+        }
+    }
+
+    void reportInvalidTriplet(const std::array<std::string_view, 3>& tokens, std::string_view message) noexcept
+    {
+        std::string line{};
+        appendInvalidTriplet(line, tokens, message);
+        printDiagnostics(line);
+    }
+}
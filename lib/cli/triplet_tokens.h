@@ -0,0 +1,180 @@
+#ifndef TRIPLET_TOKENS_H
+#define TRIPLET_TOKENS_H
+
+#include "io/endian.h"
+
+#include <array>
+#include <limits>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+
+namespace tektask::cli_parser
+{
+    static constexpr std::string_view INVALID_TRIPLET_MESSAGE{"Invalid input: failed to parse triplet"};
+    static constexpr std::string_view INVALID_TRIPLET_SIZE_MESSAGE{
+        "Invalid input: parameter count must be a multiple of 3!"
+    };
+
+    namespace detail
+    {
+        // any 19 digit number fits uint64, longer tokens can only be valid with leading zeros
+        static constexpr std::size_t MAX_FAST_DIGITS{19};
+
+        /**
+         * @brief std::from_chars based conversion, the reference for the fast paths.
+         */
+        bool parseCoefficientSlow(std::string_view token, int64_t& out) noexcept;
+
+        /**
+         * @brief true if all 8 bytes of the little-endian word are ASCII digits.
+         */
+        inline bool isEightDigits(uint64_t chunk) noexcept
+        {
+            return ((chunk & 0xF0F0F0F0F0F0F0F0) | (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) ==
+                0x3333333333333333;
+        }
+
+        /**
+         * @brief Converts 8 ASCII digits, first digit in the lowest byte, with three multiplications.
+         */
+        inline uint32_t parseEightDigits(uint64_t chunk) noexcept
+        {
+            chunk = (chunk & 0x0F0F0F0F0F0F0F0F) * 2561 >> 8;
+            chunk = (chunk & 0x00FF00FF00FF00FF) * 6553601 >> 16;
+            return static_cast<uint32_t>((chunk & 0x0000FFFF0000FFFF) * 42949672960001 >> 32);
+        }
+
+        /**
+         * @brief Applies the sign and the int64 range check to an accumulated magnitude.
+         */
+        inline bool applySign(uint64_t magnitude, bool negative, int64_t& out) noexcept
+        {
+            if (magnitude > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + negative)
+            {
+                return false;
+            }
+            out = negative ? static_cast<int64_t>(0 - magnitude) : static_cast<int64_t>(magnitude);
+            return true;
+        }
+    }
+
+    /**
+     * @brief Converts a single coefficient token into integer.
+     *
+     * The whole token has to be consumed, so values with trailing garbage,
+     * empty tokens and out of range values are rejected, exactly like std::from_chars
+     * does it: an optional minus sign followed by decimal digits only.
+     * Up to 19 digits are converted in place, 8 digits per step, longer tokens
+     * go through std::from_chars.
+     *
+     * @param token Text representation of the coefficient.
+     * @param out Reference to store the parsed value, untouched if the token is invalid.
+     * @return true if the token is a valid coefficient.
+     */
+    inline bool parseCoefficient(std::string_view token, int64_t& out) noexcept
+    {
+        const char* cursor{token.data()};
+        const char* end{cursor + token.size()};
+        const bool negative{!token.empty() && *cursor == '-'};
+        cursor += negative;
+
+        const auto digits{static_cast<std::size_t>(end - cursor)};
+        if (digits == 0 || digits > detail::MAX_FAST_DIGITS)
+        {
+            return detail::parseCoefficientSlow(token, out);
+        }
+
+        uint64_t magnitude{0};
+        if constexpr (io::IS_LITTLE_ENDIAN_HOST)
+        {
+            for (; end - cursor >= 8; cursor += 8)
+            {
+                uint64_t chunk{};
+                std::memcpy(&chunk, cursor, sizeof(chunk));
+                if (!detail::isEightDigits(chunk))
+                {
+                    return false;
+                }
+                magnitude = magnitude * 100000000 + detail::parseEightDigits(chunk);
+            }
+        }
+        for (; cursor != end; ++cursor)
+        {
+            const auto digit{static_cast<unsigned char>(*cursor - '0')};
+            if (digit > 9)
+            {
+                return false;
+            }
+            magnitude = magnitude * 10 + digit;
+        }
+        return detail::applySign(magnitude, negative, out);
+    }
+
+    /**
+     * @brief Converts a NUL terminated coefficient token, like a command line argument, into integer.
+     *
+     * Same rules as for string views, the token is converted while it is scanned,
+     * without measuring its length first.
+     *
+     * @param token NUL terminated text representation of the coefficient.
+     * @param out Reference to store the parsed value, untouched if the token is invalid.
+     * @return true if the token is a valid coefficient.
+     */
+    inline bool parseCoefficient(const char* token, int64_t& out) noexcept
+    {
+        const bool negative{*token == '-'};
+        const char* cursor{token + negative};
+
+        uint64_t magnitude{0};
+        std::size_t digits{0};
+        for (; *cursor != '\0' && digits <= detail::MAX_FAST_DIGITS; ++cursor, ++digits)
+        {
+            const auto digit{static_cast<unsigned char>(*cursor - '0')};
+            if (digit > 9)
+            {
+                return false;
+            }
+            magnitude = magnitude * 10 + digit;
+        }
+
+        if (digits == 0 || digits > detail::MAX_FAST_DIGITS)
+        {
+            return detail::parseCoefficientSlow(token, out);
+        }
+        return detail::applySign(magnitude, negative, out);
+    }
+
+    /**
+     * @brief Appends an invalid triplet report line, newline included, to the text buffer.
+     *
+     * Lets parallel parsers collect diagnostics and print them later, in input order.
+     *
+     * @param out Text buffer to append to.
+     * @param tokens Triplet tokens, missing tokens are left empty.
+     * @param message Error message.
+     */
+    void appendInvalidTriplet(std::string& out, const std::array<std::string_view, 3>& tokens,
+                              std::string_view message);
+
+    /**
+     * @brief Prints collected diagnostics with a single write.
+     *
+     * @param text Report lines, nothing is printed if empty.
+     */
+    void printDiagnostics(std::string_view text) noexcept;
+
+    /**
+     * @brief Prints an invalid triplet with a custom error message.
+     *
+     * Output format is shared between all input sources, like "(1,abc,3) => message".
+     *
+     * @param tokens Triplet tokens, missing tokens are left empty.
+     * @param message Error message to be printed.
+     */
+    void reportInvalidTriplet(const std::array<std::string_view, 3>& tokens, std::string_view message) noexcept;
+}
+
+#endif //TRIPLET_TOKENS_H
@@ -0,0 +1,144 @@
+#include "binary_results.h"
+
+#include <cstring>
+#include <stdexcept>
+
+
+namespace tektask::io
+{
+    using namespace tektask::utils::types;
+
+    namespace
+    {
+        void storeDouble(double value, std::byte* dst) noexcept
+        {
+            uint64_t bits{0};
+            std::memcpy(&bits, &value, sizeof(bits));
+            storeLittleEndian(bits, dst);
+        }
+
+        double loadDouble(const std::byte* src) noexcept
+        {
+            const auto bits{loadLittleEndian<uint64_t>(src)};
+            double value{0.0};
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+    }
+
+    void encodeResult(std::byte* record, const Triplet& triplet, const EquationSolution& solution) noexcept
+    {
+        storeLittleEndian(triplet.a, record);
+        storeLittleEndian(triplet.b, record + 8);
+        storeLittleEndian(triplet.c, record + 16);
+        storeDouble(solution.x1, record + 24);
+        storeDouble(solution.x2, record + 32);
+        storeDouble(solution.xMin, record + 40);
+        record[48] = static_cast<std::byte>(solution.kind);
+        record[49] = static_cast<std::byte>(BINARY_RESULT_VALID);
+        std::memset(record + 50, 0, BINARY_RESULTS_RECORD_SIZE - 50);
+    }
+
+    BinaryResultReader::BinaryResultReader(const std::string& path) : m_file(path)
+    {
+        const std::byte* data{m_file.data()};
+        if (m_file.size() < BINARY_RESULTS_HEADER_SIZE ||
+            std::memcmp(data, BINARY_RESULTS_MAGIC.data(), BINARY_RESULTS_MAGIC.size()) != 0)
+        {
+            throw std::invalid_argument("Invalid input: not a binary results file " + path);
+        }
+
+        const auto version{loadLittleEndian<uint32_t>(data + 8)};
+        const auto recordSize{loadLittleEndian<uint32_t>(data + 12)};
+        if (version != BINARY_RESULTS_VERSION || recordSize != BINARY_RESULTS_RECORD_SIZE)
+        {
+            throw std::invalid_argument("Invalid input: unsupported binary results format " + path);
+        }
+
+        const auto count{loadLittleEndian<uint64_t>(data + 16)};
+        const auto available{(m_file.size() - BINARY_RESULTS_HEADER_SIZE) / BINARY_RESULTS_RECORD_SIZE};
+        if (count > available)
+        {
+            throw std::invalid_argument("Invalid input: truncated binary results file " + path);
+        }
+
+        m_records = data + BINARY_RESULTS_HEADER_SIZE;
+        m_count = static_cast<std::size_t>(count);
+        m_rejected = static_cast<std::size_t>(loadLittleEndian<uint64_t>(data + 24));
+    }
+
+    BinaryResult BinaryResultReader::operator[](std::size_t index) const noexcept
+    {
+        const std::byte* record{m_records + index * BINARY_RESULTS_RECORD_SIZE};
+        BinaryResult result{};
+        result.triplet = {
+            loadLittleEndian<int64_t>(record),
+            loadLittleEndian<int64_t>(record + 8),
+            loadLittleEndian<int64_t>(record + 16),
+            static_cast<int64_t>(index),
+        };
+        result.solution = {
+            static_cast<SolveCase>(record[48]),
+            loadDouble(record + 24),
+            loadDouble(record + 32),
+            loadDouble(record + 40),
+        };
+        result.valid = (static_cast<uint8_t>(record[49]) & BINARY_RESULT_VALID) != 0;
+        return result;
+    }
+
+    BinaryResultWriter::BinaryResultWriter(const std::string& path) :
+        m_output(path, std::ios::binary | std::ios::trunc),
+        m_buffer(BUFFER_RECORDS * BINARY_RESULTS_RECORD_SIZE)
+    {
+        if (!m_output)
+        {
+            throw std::runtime_error("Failed to create " + path);
+        }
+        _writeHeader();
+    }
+
+    void BinaryResultWriter::finish()
+    {
+        _writeBuffer();
+        m_output.seekp(0);
+        _writeHeader();
+        m_output.flush();
+        if (!m_output)
+        {
+            throw std::runtime_error("Failed to write binary results file");
+        }
+    }
+
+    std::byte* BinaryResultWriter::_next()
+    {
+        if (m_buffered == BUFFER_RECORDS)
+        {
+            _writeBuffer();
+        }
+
+        std::byte* record{m_buffer.data() + m_buffered * BINARY_RESULTS_RECORD_SIZE};
+        std::memset(record, 0, BINARY_RESULTS_RECORD_SIZE);
+        ++m_buffered;
+        ++m_count;
+        return record;
+    }
+
+    void BinaryResultWriter::_writeBuffer()
+    {
+        m_output.write(reinterpret_cast<const char*>(m_buffer.data()),
+                       static_cast<std::streamsize>(m_buffered * BINARY_RESULTS_RECORD_SIZE));
+        m_buffered = 0;
+    }
+
+    void BinaryResultWriter::_writeHeader()
+    {
+        std::array<std::byte, BINARY_RESULTS_HEADER_SIZE> header{};
+        std::memcpy(header.data(), BINARY_RESULTS_MAGIC.data(), BINARY_RESULTS_MAGIC.size());
+        storeLittleEndian(BINARY_RESULTS_VERSION, header.data() + 8);
+        storeLittleEndian(static_cast<uint32_t>(BINARY_RESULTS_RECORD_SIZE), header.data() + 12);
+        storeLittleEndian(static_cast<uint64_t>(m_count), header.data() + 16);
+        storeLittleEndian(static_cast<uint64_t>(m_rejected), header.data() + 24);
+        m_output.write(reinterpret_cast<const char*>(header.data()), header.size());
+    }
+}
@@ -0,0 +1,179 @@
+#ifndef BINARY_RESULTS_H
+#define BINARY_RESULTS_H
+
+#include "io/endian.h"
+#include "io/mapped_file.h"
+#include "utils/types/types.h"
+
+#include <array>
+#include <vector>
+#include <fstream>
+
+
+namespace tektask::io
+{
+    /**
+     * Binary results file layout, all values are little-endian, doubles are IEEE-754 binary64.
+     *
+     * header (32 bytes):
+     *   [0, 8)   magic "TEKRSLTS"
+     *   [8, 12)  uint32 format version
+     *   [12, 16) uint32 record size in bytes
+     *   [16, 24) uint64 records count
+     *   [24, 32) uint64 rejected records count
+     *
+     * records (56 bytes each), in input order:
+     *   [0, 24)  int64 a, int64 b, int64 c
+     *   [24, 48) double x1, double x2, double xMin
+     *   [48]     uint8 SolveCase
+     *   [49]     uint8 flags, bit 0 is set for solved equations, clear for rejected input triplets
+     *   [50, 56) reserved, zero
+     *
+     * Rejected records keep their input position and have all other fields zero,
+     * so the n-th record belongs to the n-th input triplet.
+     */
+    static constexpr std::array<char, 8> BINARY_RESULTS_MAGIC{'T', 'E', 'K', 'R', 'S', 'L', 'T', 'S'};
+    static constexpr uint32_t BINARY_RESULTS_VERSION{1};
+    static constexpr std::size_t BINARY_RESULTS_HEADER_SIZE{32};
+    static constexpr std::size_t BINARY_RESULTS_RECORD_SIZE{56};
+    static constexpr uint8_t BINARY_RESULT_VALID{0x01};
+
+    /**
+     * @brief Decoded binary results record.
+     */
+    struct BinaryResult
+    {
+        utils::types::Triplet triplet{};
+        utils::types::EquationSolution solution{};
+        bool valid{false};
+    };
+
+    /**
+     * @brief Encodes a solved equation into a record.
+     *
+     * @param record Destination, BINARY_RESULTS_RECORD_SIZE bytes.
+     */
+    void encodeResult(std::byte* record, const utils::types::Triplet& triplet,
+                      const utils::types::EquationSolution& solution) noexcept;
+
+    /**
+     * @class BinaryResultReader
+     * @brief Zero-copy random access view over a memory mapped binary results file.
+     */
+    class BinaryResultReader
+    {
+    public:
+        /**
+         * @brief Maps the file and validates its header.
+         *
+         * @param path Path of the binary results file.
+         *
+         * @throws if the file can't be mapped or has invalid format.
+         */
+        explicit BinaryResultReader(const std::string& path);
+
+        ~BinaryResultReader() = default;
+        BinaryResultReader(const BinaryResultReader&) = delete;
+        BinaryResultReader& operator=(const BinaryResultReader&) = delete;
+        BinaryResultReader(BinaryResultReader&&) noexcept = default;
+        BinaryResultReader& operator=(BinaryResultReader&&) noexcept = default;
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return m_count;
+        }
+
+        [[nodiscard]] std::size_t rejectedCount() const noexcept
+        {
+            return m_rejected;
+        }
+
+        /**
+         * @brief Decodes the record at the given index.
+         *
+         * @param index Record index, must be less than size().
+         * @return Result with Triplet::id equal to the record index.
+         */
+        [[nodiscard]] BinaryResult operator[](std::size_t index) const noexcept;
+
+    private:
+        MappedFile m_file;
+        const std::byte* m_records{nullptr};
+        std::size_t m_count{0};
+        std::size_t m_rejected{0};
+    };
+
+    /**
+     * @class BinaryResultWriter
+     * @brief Writes records into a binary results file.
+     *
+     * Records are buffered and written in large blocks, header counts are patched
+     * by finish(), so the output has to be a seekable file.
+     */
+    class BinaryResultWriter
+    {
+    public:
+        // records collected before a single write
+        static constexpr std::size_t BUFFER_RECORDS{16 * 1024};
+
+        /**
+         * @brief Creates the output file and reserves space for the header.
+         *
+         * @param path Path of the output file, truncated if exists.
+         *
+         * @throws if the file can't be created.
+         */
+        explicit BinaryResultWriter(const std::string& path);
+
+        ~BinaryResultWriter() = default;
+        BinaryResultWriter(const BinaryResultWriter&) = delete;
+        BinaryResultWriter& operator=(const BinaryResultWriter&) = delete;
+
+        /**
+         * @brief Appends a solved equation record.
+         */
+        void write(const utils::types::Triplet& triplet, const utils::types::EquationSolution& solution)
+        {
+            encodeResult(_next(), triplet, solution);
+        }
+
+        /**
+         * @brief Appends a rejected input triplet record.
+         */
+        void writeRejected()
+        {
+            _next();
+            ++m_rejected;
+        }
+
+        /**
+         * @brief Writes buffered records, the final header and flushes the file.
+         *
+         * @throws if writing failed.
+         */
+        void finish();
+
+        [[nodiscard]] std::size_t count() const noexcept
+        {
+            return m_count;
+        }
+
+    private:
+        /**
+         * @brief Returns zeroed space of the next record, writes the buffer out if it is full.
+         */
+        std::byte* _next();
+
+        void _writeBuffer();
+
+        void _writeHeader();
+
+        std::ofstream m_output;
+        std::vector<std::byte> m_buffer;
+        std::size_t m_buffered{0};
+        std::size_t m_count{0};
+        std::size_t m_rejected{0};
+    };
+}
+
+#endif //BINARY_RESULTS_H
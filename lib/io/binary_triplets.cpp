@@ -0,0 +1,78 @@
+#include "binary_triplets.h"
+
+#include <cstring>
+#include <stdexcept>
+
+
+namespace tektask::io
+{
+    using namespace tektask::utils::types;
+
+    BinaryTripletReader::BinaryTripletReader(const std::string& path) : m_file(path)
+    {
+        const std::byte* data{m_file.data()};
+        if (m_file.size() < BINARY_TRIPLETS_HEADER_SIZE ||
+            std::memcmp(data, BINARY_TRIPLETS_MAGIC.data(), BINARY_TRIPLETS_MAGIC.size()) != 0)
+        {
+            throw std::invalid_argument("Invalid input: not a binary triplets file " + path);
+        }
+
+        const auto version{loadLittleEndian<uint32_t>(data + 8)};
+        const auto recordSize{loadLittleEndian<uint32_t>(data + 12)};
+        if (version != BINARY_TRIPLETS_VERSION || recordSize != BINARY_TRIPLETS_RECORD_SIZE)
+        {
+            throw std::invalid_argument("Invalid input: unsupported binary triplets format " + path);
+        }
+
+        const auto count{loadLittleEndian<uint64_t>(data + 16)};
+        const auto available{(m_file.size() - BINARY_TRIPLETS_HEADER_SIZE) / BINARY_TRIPLETS_RECORD_SIZE};
+        if (count > available)
+        {
+            throw std::invalid_argument("Invalid input: truncated binary triplets file " + path);
+        }
+
+        m_records = data + BINARY_TRIPLETS_HEADER_SIZE;
+        m_count = static_cast<std::size_t>(count);
+    }
+
+    BinaryTripletWriter::BinaryTripletWriter(const std::string& path) :
+        m_output(path, std::ios::binary | std::ios::trunc)
+    {
+        if (!m_output)
+        {
+            throw std::runtime_error("Failed to create " + path);
+        }
+        _writeHeader();
+    }
+
+    void BinaryTripletWriter::write(const Triplet& triplet)
+    {
+        std::array<std::byte, BINARY_TRIPLETS_RECORD_SIZE> record{};
+        storeLittleEndian(triplet.a, record.data());
+        storeLittleEndian(triplet.b, record.data() + sizeof(int64_t));
+        storeLittleEndian(triplet.c, record.data() + 2 * sizeof(int64_t));
+        m_output.write(reinterpret_cast<const char*>(record.data()), record.size());
+        ++m_count;
+    }
+
+    void BinaryTripletWriter::finish()
+    {
+        m_output.seekp(0);
+        _writeHeader();
+        m_output.flush();
+        if (!m_output)
+        {
+            throw std::runtime_error("Failed to write binary triplets file");
+        }
+    }
+
+    void BinaryTripletWriter::_writeHeader()
+    {
+        std::array<std::byte, BINARY_TRIPLETS_HEADER_SIZE> header{};
+        std::memcpy(header.data(), BINARY_TRIPLETS_MAGIC.data(), BINARY_TRIPLETS_MAGIC.size());
+        storeLittleEndian(BINARY_TRIPLETS_VERSION, header.data() + 8);
+        storeLittleEndian(static_cast<uint32_t>(BINARY_TRIPLETS_RECORD_SIZE), header.data() + 12);
+        storeLittleEndian(static_cast<uint64_t>(m_count), header.data() + 16);
+        m_output.write(reinterpret_cast<const char*>(header.data()), header.size());
+    }
+}
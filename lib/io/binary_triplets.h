@@ -0,0 +1,133 @@
+#ifndef BINARY_TRIPLETS_H
+#define BINARY_TRIPLETS_H
+
+#include "io/endian.h"
+#include "io/mapped_file.h"
+#include "utils/types/types.h"
+
+#include <array>
+#include <fstream>
+
+
+namespace tektask::io
+{
+    /**
+     * Binary triplets file layout, all values are little-endian.
+     *
+     * header (32 bytes):
+     *   [0, 8)   magic "TEKTRIPL"
+     *   [8, 12)  uint32 format version
+     *   [12, 16) uint32 record size in bytes
+     *   [16, 24) uint64 records count
+     *   [24, 32) reserved, zero
+     *
+     * records (24 bytes each): int64 a, int64 b, int64 c
+     */
+    static constexpr std::array<char, 8> BINARY_TRIPLETS_MAGIC{'T', 'E', 'K', 'T', 'R', 'I', 'P', 'L'};
+    static constexpr uint32_t BINARY_TRIPLETS_VERSION{1};
+    static constexpr std::size_t BINARY_TRIPLETS_HEADER_SIZE{32};
+    static constexpr std::size_t BINARY_TRIPLETS_RECORD_SIZE{3 * sizeof(int64_t)};
+
+    /**
+     * @class BinaryTripletReader
+     * @brief Zero-copy random access view over a memory mapped binary triplets file.
+     *
+     * Records are decoded straight from the mapping on access, no parsing
+     * and no intermediate triplets storage is involved.
+     */
+    class BinaryTripletReader
+    {
+    public:
+        using value_type = utils::types::Triplet;
+
+        /**
+         * @brief Maps the file and validates its header.
+         *
+         * @param path Path of the binary triplets file.
+         *
+         * @throws if the file can't be mapped or has invalid format.
+         */
+        explicit BinaryTripletReader(const std::string& path);
+
+        ~BinaryTripletReader() = default;
+        BinaryTripletReader(const BinaryTripletReader&) = delete;
+        BinaryTripletReader& operator=(const BinaryTripletReader&) = delete;
+        BinaryTripletReader(BinaryTripletReader&&) noexcept = default;
+        BinaryTripletReader& operator=(BinaryTripletReader&&) noexcept = default;
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return m_count;
+        }
+
+        /**
+         * @brief Decodes the record at the given index.
+         *
+         * @param index Record index, must be less than size().
+         * @return Triplet with id equal to the record index.
+         */
+        utils::types::Triplet operator[](std::size_t index) const noexcept
+        {
+            const std::byte* record{m_records + index * BINARY_TRIPLETS_RECORD_SIZE};
+            return {
+                loadLittleEndian<int64_t>(record),
+                loadLittleEndian<int64_t>(record + sizeof(int64_t)),
+                loadLittleEndian<int64_t>(record + 2 * sizeof(int64_t)),
+                static_cast<int64_t>(index),
+            };
+        }
+
+    private:
+        MappedFile m_file;
+        const std::byte* m_records{nullptr};
+        std::size_t m_count{0};
+    };
+
+    /**
+     * @class BinaryTripletWriter
+     * @brief Writes triplets into a binary triplets file.
+     *
+     * Header records count is patched by finish(), so the output has to be a seekable file.
+     */
+    class BinaryTripletWriter
+    {
+    public:
+        /**
+         * @brief Creates the output file and reserves space for the header.
+         *
+         * @param path Path of the output file, truncated if exists.
+         *
+         * @throws if the file can't be created.
+         */
+        explicit BinaryTripletWriter(const std::string& path);
+
+        ~BinaryTripletWriter() = default;
+        BinaryTripletWriter(const BinaryTripletWriter&) = delete;
+        BinaryTripletWriter& operator=(const BinaryTripletWriter&) = delete;
+
+        /**
+         * @brief Appends a single record, Triplet::id is not stored.
+         */
+        void write(const utils::types::Triplet& triplet);
+
+        /**
+         * @brief Writes the final header and flushes the file.
+         *
+         * @throws if writing failed.
+         */
+        void finish();
+
+        [[nodiscard]] std::size_t count() const noexcept
+        {
+            return m_count;
+        }
+
+    private:
+        void _writeHeader();
+
+        std::ofstream m_output;
+        std::size_t m_count{0};
+    };
+}
+
+#endif //BINARY_TRIPLETS_H
@@ -0,0 +1,69 @@
+#ifndef ENDIAN_H
+#define ENDIAN_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+
+namespace tektask::io
+{
+    static constexpr bool IS_LITTLE_ENDIAN_HOST{__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__};
+
+    /**
+     * @brief Reverses byte order of 32 and 64-bit unsigned integers.
+     */
+    template <typename T>
+    constexpr T byteSwap(T value) noexcept
+    {
+        static_assert(std::is_same_v<T, uint32_t> || std::is_same_v<T, uint64_t>, "Unsupported byte swap type");
+        if constexpr (sizeof(T) == sizeof(uint32_t))
+        {
+            return __builtin_bswap32(value);
+        }
+        else
+        {
+            return __builtin_bswap64(value);
+        }
+    }
+
+    /**
+     * @brief Loads a little-endian value from possibly unaligned memory.
+     *
+     * @tparam T Fixed width integer type.
+     * @param src Pointer to the value bytes.
+     */
+    template <typename T>
+    T loadLittleEndian(const std::byte* src) noexcept
+    {
+        using Unsigned = std::make_unsigned_t<T>;
+        Unsigned raw{};
+        std::memcpy(&raw, src, sizeof(raw));
+        if constexpr (!IS_LITTLE_ENDIAN_HOST)
+        {
+            raw = byteSwap(raw);
+        }
+        return static_cast<T>(raw);
+    }
+
+    /**
+     * @brief Stores a value as little-endian into possibly unaligned memory.
+     *
+     * @tparam T Fixed width integer type.
+     * @param value The value to store.
+     * @param dst Pointer to the destination bytes.
+     */
+    template <typename T>
+    void storeLittleEndian(T value, std::byte* dst) noexcept
+    {
+        auto raw{static_cast<std::make_unsigned_t<T>>(value)};
+        if constexpr (!IS_LITTLE_ENDIAN_HOST)
+        {
+            raw = byteSwap(raw);
+        }
+        std::memcpy(dst, &raw, sizeof(raw));
+    }
+}
+
+#endif //ENDIAN_H
@@ -0,0 +1,80 @@
+#include "mapped_file.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <utility>
+#include <stdexcept>
+
+
+namespace tektask::io
+{
+    MappedFile::MappedFile(const std::string& path)
+    {
+        const int fd{::open(path.c_str(), O_RDONLY)};
+        if (fd < 0)
+        {
+            throw std::runtime_error("Failed to open " + path);
+        }
+
+        struct stat info{};
+        if (::fstat(fd, &info) != 0)
+        {
+            ::close(fd);
+            throw std::runtime_error("Failed to stat " + path);
+        }
+
+        m_size = static_cast<std::size_t>(info.st_size);
+        if (m_size == 0)
+        {
+            // empty file can't be mapped, nothing to read anyway
+            ::close(fd);
+            return;
+        }
+
+        void* mapping{::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0)};
+        ::close(fd);
+        if (mapping == MAP_FAILED)
+        {
+            throw std::runtime_error("Failed to map " + path);
+        }
+
+        // records are consumed front to back, let the kernel read ahead aggressively
+        ::madvise(mapping, m_size, MADV_SEQUENTIAL);
+        m_data = static_cast<const std::byte*>(mapping);
+    }
+
+    MappedFile::~MappedFile()
+    {
+        _unmap();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept :
+        m_data(std::exchange(other.m_data, nullptr)),
+        m_size(std::exchange(other.m_size, 0))
+    {
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+        _unmap();
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+        return *this;
+    }
+
+    void MappedFile::_unmap() noexcept
+    {
+        if (m_data)
+        {
+            ::munmap(const_cast<std::byte*>(m_data), m_size);
+            m_data = nullptr;
+        }
+    }
+}
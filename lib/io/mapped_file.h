@@ -0,0 +1,54 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <cstddef>
+
+
+namespace tektask::io
+{
+    /**
+     * @class MappedFile
+     * @brief Read-only memory mapping of a whole file.
+     *
+     * Owns the mapping and releases it on destruction. Data is paged in lazily
+     * by the kernel, so the file content is never copied into process buffers.
+     */
+    class MappedFile
+    {
+    public:
+        /**
+         * @brief Maps the file into memory.
+         *
+         * @param path Path of the file to map.
+         *
+         * @throws if the file can't be opened or mapped.
+         */
+        explicit MappedFile(const std::string& path);
+
+        ~MappedFile();
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        [[nodiscard]] const std::byte* data() const noexcept
+        {
+            return m_data;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return m_size;
+        }
+
+    private:
+        void _unmap() noexcept;
+
+        const std::byte* m_data{nullptr};
+        std::size_t m_size{0};
+    };
+}
+
+#endif //MAPPED_FILE_H
@@ -0,0 +1,328 @@
+#include "output_writer.h"
+
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+#include <system_error>
+
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <climits>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <sys/stat.h>
+
+
+namespace tektask::output
+{
+    namespace
+    {
+        [[noreturn]] void writeError()
+        {
+            throw std::system_error(errno, std::generic_category(), "Output write failed");
+        }
+
+        /**
+         * @brief Waits until a non-blocking descriptor accepts more data.
+         */
+        void waitWritable(int fd)
+        {
+            pollfd request{fd, POLLOUT, 0};
+            while (::poll(&request, 1, -1) < 0 && errno == EINTR)
+            {
+            }
+        }
+
+        /**
+         * @brief true if the call has to be repeated, throws on real errors.
+         */
+        bool retry(int fd)
+        {
+            if (errno == EINTR)
+            {
+                return true;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                waitWritable(fd);
+                return true;
+            }
+            return false;
+        }
+    }
+
+    std::mutex& outputMutex() noexcept
+    {
+        static std::mutex mutex{};
+        return mutex;
+    }
+
+    OutputWriter::OutputWriter(int fd, std::size_t bufferSize) :
+        m_fd(fd)
+    {
+#ifdef __linux__
+        struct stat info{};
+        if (::fstat(fd, &info) == 0 && S_ISFIFO(info.st_mode))
+        {
+            // a larger pipe lets more pages be in flight, the reader may have its own limit
+            ::fcntl(fd, F_SETPIPE_SZ, static_cast<int>(PIPE_SIZE));
+            const auto pipeSize{::fcntl(fd, F_GETPIPE_SZ)};
+            const auto pageSize{::sysconf(_SC_PAGESIZE)};
+            if (pipeSize > 0 && pageSize > 0)
+            {
+                // half the pipe per batch, the writer fills the next one while the reader drains the pipe
+                m_pageSize = static_cast<std::size_t>(pageSize);
+                m_batchSize = std::max<std::size_t>(static_cast<std::size_t>(pipeSize) / m_pageSize / 2, 1) * m_pageSize;
+                m_mappedSize = m_batchSize + (MAX_RESERVE + m_pageSize - 1) / m_pageSize * m_pageSize;
+                m_pages = _mapPages();
+                m_splicing = true;
+            }
+        }
+#endif
+
+        if (!m_splicing)
+        {
+            m_buffer.resize(std::max<std::size_t>(bufferSize, 1) + MAX_RESERVE);
+        }
+    }
+
+    OutputWriter::~OutputWriter()
+    {
+        _unmapPages();
+    }
+
+    char* OutputWriter::reserve(std::size_t size)
+    {
+        if (m_splicing)
+        {
+            // after splicing less than a page is left, there is always room for MAX_RESERVE
+            if (m_end + size > m_mappedSize)
+            {
+                _spliceFullPages();
+            }
+            return m_pages + m_end;
+        }
+
+        if (m_buffer.size() - m_size < size)
+        {
+            flush();
+        }
+        return m_buffer.data() + m_size;
+    }
+
+    void OutputWriter::commit(std::size_t size)
+    {
+        if (m_splicing)
+        {
+            m_end += size;
+            if (m_end >= m_batchSize)
+            {
+                _spliceFullPages();
+            }
+            return;
+        }
+
+        m_size += size;
+        if (m_size >= m_buffer.size() - MAX_RESERVE)
+        {
+            flush();
+        }
+    }
+
+    void OutputWriter::write(std::string_view text)
+    {
+        if (!m_splicing && text.size() >= m_buffer.size() - MAX_RESERVE)
+        {
+            flush();
+            std::lock_guard lock{outputMutex()};
+            _writeAll(text.data(), text.size());
+            return;
+        }
+
+        while (!text.empty())
+        {
+            const auto size{std::min(text.size(), MAX_RESERVE)};
+            std::memcpy(reserve(size), text.data(), size);
+            commit(size);
+            text.remove_prefix(size);
+        }
+    }
+
+    void OutputWriter::write(const std::vector<std::string>& chunks)
+    {
+        if (m_splicing)
+        {
+            for (const auto& chunk : chunks)
+            {
+                write(chunk);
+            }
+            return;
+        }
+
+        std::vector<iovec> vector{};
+        vector.reserve(chunks.size() + 1);
+        if (m_size > 0)
+        {
+            vector.push_back({m_buffer.data(), m_size});
+        }
+        for (const auto& chunk : chunks)
+        {
+            if (!chunk.empty())
+            {
+                vector.push_back({const_cast<char*>(chunk.data()), chunk.size()});
+            }
+        }
+        m_size = 0;
+
+        // a single writev() per IOV_MAX chunks, partial writes continue from the first unwritten byte
+        std::lock_guard lock{outputMutex()};
+        auto* first{vector.data()};
+        auto* last{vector.data() + vector.size()};
+        while (first != last)
+        {
+            const auto count{static_cast<int>(std::min<std::ptrdiff_t>(last - first, IOV_MAX))};
+            auto written{::writev(m_fd, first, count)};
+            if (written < 0)
+            {
+                if (retry(m_fd))
+                {
+                    continue;
+                }
+                writeError();
+            }
+
+            while (first != last && static_cast<std::size_t>(written) >= first->iov_len)
+            {
+                written -= static_cast<ssize_t>(first->iov_len);
+                ++first;
+            }
+            if (first != last)
+            {
+                first->iov_base = static_cast<char*>(first->iov_base) + written;
+                first->iov_len -= static_cast<std::size_t>(written);
+            }
+        }
+    }
+
+    void OutputWriter::flush()
+    {
+        if (!m_splicing)
+        {
+            if (m_size > 0)
+            {
+                std::lock_guard lock{outputMutex()};
+                _writeAll(m_buffer.data(), m_size);
+                m_size = 0;
+            }
+            return;
+        }
+
+        _spliceFullPages();
+        if (m_end > 0)
+        {
+            // the tail page is copied by write(), so it stays writable
+            _lockOutput();
+            _writeAll(m_pages, m_end);
+            m_end = 0;
+        }
+
+        // committed text ends with a complete line
+        if (m_lock.owns_lock())
+        {
+            m_lock.unlock();
+        }
+    }
+
+    void OutputWriter::_writeAll(const char* data, std::size_t size)
+    {
+        while (size > 0)
+        {
+            const auto written{::write(m_fd, data, size)};
+            if (written < 0)
+            {
+                if (retry(m_fd))
+                {
+                    continue;
+                }
+                writeError();
+            }
+            data += written;
+            size -= static_cast<std::size_t>(written);
+        }
+    }
+
+    void OutputWriter::_spliceFullPages()
+    {
+        const auto full{m_end / m_pageSize * m_pageSize};
+        if (full == 0)
+        {
+            return;
+        }
+
+        _lockOutput();
+        _splice(m_pages, full);
+
+        // spliced pages are never written again, the unfinished tail moves to fresh ones
+        char* fresh{_mapPages()};
+        std::memcpy(fresh, m_pages + full, m_end - full);
+        _unmapPages();
+        m_pages = fresh;
+        m_end -= full;
+    }
+
+    void OutputWriter::_splice(const char* data, std::size_t size)
+    {
+#ifdef __linux__
+        while (size > 0)
+        {
+            iovec pages{const_cast<char*>(data), size};
+            const auto spliced{::vmsplice(m_fd, &pages, 1, SPLICE_F_GIFT)};
+            if (spliced < 0)
+            {
+                if (retry(m_fd))
+                {
+                    continue;
+                }
+                if (errno == EINVAL || errno == ENOSYS || errno == EPERM)
+                {
+                    break;
+                }
+                writeError();
+            }
+            data += spliced;
+            size -= static_cast<std::size_t>(spliced);
+        }
+#endif
+        // the rest goes by plain write() if splicing isn't supported
+        _writeAll(data, size);
+    }
+
+    char* OutputWriter::_mapPages() const
+    {
+        void* pages{::mmap(nullptr, m_mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)};
+        if (pages == MAP_FAILED)
+        {
+            throw std::system_error(errno, std::generic_category(), "Output buffer allocation failed");
+        }
+        return static_cast<char*>(pages);
+    }
+
+    void OutputWriter::_lockOutput()
+    {
+        if (!m_lock.owns_lock())
+        {
+            m_lock = std::unique_lock{outputMutex()};
+        }
+    }
+
+    void OutputWriter::_unmapPages() noexcept
+    {
+        // spliced pages stay referenced by the pipe, unmapping doesn't change them
+        if (m_pages != nullptr)
+        {
+            ::munmap(m_pages, m_mappedSize);
+            m_pages = nullptr;
+        }
+    }
+}
@@ -0,0 +1,153 @@
+#ifndef OUTPUT_WRITER_H
+#define OUTPUT_WRITER_H
+
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+
+
+namespace tektask::output
+{
+    /**
+     * @brief Serializes output of OutputWriter and other writers sharing the descriptor (diagnostics, etc).
+     *
+     * Other writers take it around every write, so their text never lands inside a line.
+     */
+    std::mutex& outputMutex() noexcept;
+
+    /**
+     * @class OutputWriter
+     * @brief Buffered writer straight into a file descriptor, bypasses iostreams.
+     *
+     * Text is formatted in place into the writer buffer through reserve()/commit()
+     * and goes out with a single write() per buffer, ready made text chunks go out
+     * with writev() without copying.
+     *
+     * If the descriptor is a pipe, text is formatted into freshly mapped pages and whole
+     * pages are gifted to the pipe with vmsplice(), so the kernel doesn't copy the text
+     * again. A spliced page may stay referenced long after it left the pipe, its reader
+     * can splice it on further, so it is never written again: every batch of pages is
+     * unmapped once spliced and the next batch goes into fresh ones. The unfinished
+     * tail page is moved to the fresh pages, or written with plain write() on flush().
+     *
+     * Bytes go out in exactly the order they were committed. Writes hold outputMutex(),
+     * splicing holds it from the first spliced page until the following flush(), as
+     * pages end in the middle of a line. So callers commit whole lines and flush
+     * before waiting for anything another writer could be producing.
+     */
+    class OutputWriter
+    {
+    public:
+        static constexpr std::size_t DEFAULT_BUFFER_SIZE{256 * 1024};
+
+        // pipe capacity requested for splicing, the current one is kept if the request fails
+        static constexpr std::size_t PIPE_SIZE{1024 * 1024};
+
+        /**
+         * @brief Constructs a writer on top of the descriptor, it is not closed by the writer.
+         *
+         * @param fd Output file descriptor.
+         * @param bufferSize Amount of buffered text written at once, if the descriptor is not a pipe.
+         */
+        explicit OutputWriter(int fd, std::size_t bufferSize = DEFAULT_BUFFER_SIZE);
+
+        /**
+         * @brief Releases the buffers, unwritten text is lost, call flush() first.
+         */
+        ~OutputWriter();
+
+        OutputWriter(const OutputWriter&) = delete;
+        OutputWriter(OutputWriter&&) = delete;
+        OutputWriter& operator=(const OutputWriter&) = delete;
+        OutputWriter& operator=(OutputWriter&&) = delete;
+
+        /**
+         * @brief true if the writer hands pages to a pipe with vmsplice().
+         */
+        [[nodiscard]] bool splicing() const noexcept
+        {
+            return m_splicing;
+        }
+
+        /**
+         * @brief Returns contiguous space for at most size bytes, valid until commit().
+         *
+         * @param size Upper bound of the text size, at most MAX_RESERVE.
+         */
+        char* reserve(std::size_t size);
+
+        /**
+         * @brief Appends size bytes written into the reserved space.
+         */
+        void commit(std::size_t size);
+
+        /**
+         * @brief Appends a copy of the text.
+         */
+        void write(std::string_view text);
+
+        /**
+         * @brief Writes buffered text followed by the chunks, chunks are not copied unless splicing.
+         */
+        void write(const std::vector<std::string>& chunks);
+
+        /**
+         * @brief Writes all buffered text.
+         *
+         * @throws if writing failed.
+         */
+        void flush();
+
+        // largest single reserve()
+        static constexpr std::size_t MAX_RESERVE{4096};
+
+    private:
+        /**
+         * @brief Writes the whole range with write(), waits if the descriptor is non-blocking.
+         */
+        void _writeAll(const char* data, std::size_t size);
+
+        /**
+         * @brief Splices buffered whole pages into the pipe and continues in fresh pages.
+         */
+        void _spliceFullPages();
+
+        /**
+         * @brief Gifts whole pages to the pipe, falls back to write() if the pipe doesn't support vmsplice().
+         */
+        void _splice(const char* data, std::size_t size);
+
+        /**
+         * @brief Maps m_mappedSize bytes of fresh pages.
+         */
+        [[nodiscard]] char* _mapPages() const;
+
+        void _unmapPages() noexcept;
+
+        /**
+         * @brief Takes outputMutex(), if it isn't held already.
+         */
+        void _lockOutput();
+
+        int m_fd{-1};
+        bool m_splicing{false};
+
+        // plain mode buffer
+        std::vector<char> m_buffer{};
+        std::size_t m_size{0};
+
+        // splicing mode pages, [0, m_end) is not written yet, whole pages go out once m_batchSize is reached
+        char* m_pages{nullptr};
+        std::size_t m_mappedSize{0};
+        std::size_t m_batchSize{0};
+        std::size_t m_end{0};
+        std::size_t m_pageSize{4096};
+
+        // held while the descriptor is in the middle of a line
+        std::unique_lock<std::mutex> m_lock{};
+    };
+}
+
+#endif //OUTPUT_WRITER_H
@@ -0,0 +1,97 @@
+#ifndef PARALLEL_FORMATTER_H
+#define PARALLEL_FORMATTER_H
+
+#include "resolver/result_formatter.h"
+#include "thread/thread_pool.h"
+#include "utils/types/types.h"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+namespace tektask::output
+{
+    /**
+     * @brief Formats a contiguous range of solutions into newline terminated text lines.
+     *
+     * @tparam SourceType Random access Triplet source (std::vector, BinaryTripletReader, etc).
+     * @param triplets Equation coefficients, indexed by Triplet::id.
+     * @param solutions Numeric solutions, indexed by Triplet::id.
+     * @param first Index of the first solution.
+     * @param last Index past the last solution.
+     * @param out Text buffer, formatted lines are appended to it.
+     */
+    template <typename SourceType>
+    void formatRange(const SourceType& triplets, const std::vector<utils::types::EquationSolution>& solutions,
+                     std::size_t first, std::size_t last, std::string& out)
+    {
+        // reserve the upper bound once, then shrink to the actual size
+        const auto offset{out.size()};
+        out.resize(offset + (last - first) * (resolver::MAX_RESULT_LENGTH + 1));
+
+        char* cursor{out.data() + offset};
+        for (auto i{first}; i < last; ++i)
+        {
+            cursor += resolver::formatResult(cursor, triplets[i], solutions[i]);
+            *cursor++ = '\n';
+        }
+        out.resize(cursor - out.data());
+    }
+
+    // solutions formatted by a single thread in one round, bounds the text kept in memory
+    static constexpr std::size_t FORMAT_WINDOW{64 * 1024};
+
+    /**
+     * @brief Formats a range of solutions into text as a separate parallel stage.
+     *
+     * The range is split into contiguous id ranges, one per thread, every thread
+     * formats its range into its own buffer. Buffers are reused between calls,
+     * so formatting a large input window by window keeps memory bounded.
+     *
+     * @tparam SourceType Random access Triplet source (std::vector, BinaryTripletReader, etc).
+     * @param triplets Equation coefficients, indexed by Triplet::id.
+     * @param solutions Numeric solutions, indexed by Triplet::id.
+     * @param first Index of the first solution.
+     * @param last Index past the last solution.
+     * @param threadCount Number of formatting threads.
+     * @param chunks Text chunks in id order, overwritten, concatenation gives the range lines in input order.
+     * @param pool Idle workers formatting the other ranges, threads are started per call if nullptr.
+     */
+    template <typename SourceType>
+    void formatParallel(const SourceType& triplets, const std::vector<utils::types::EquationSolution>& solutions,
+                        std::size_t first, std::size_t last, uint32_t threadCount, std::vector<std::string>& chunks,
+                        thread::ThreadPool* pool = nullptr)
+    {
+        const auto count{last - first};
+        threadCount = static_cast<uint32_t>(std::clamp<std::size_t>(threadCount, 1, std::max<std::size_t>(count, 1)));
+
+        chunks.resize(threadCount);
+        thread::runParts(threadCount, [&](std::size_t index)
+        {
+            chunks[index].clear();
+            formatRange(triplets, solutions, first + count * index / threadCount,
+                        first + count * (index + 1) / threadCount, chunks[index]);
+        }, pool);
+    }
+
+    /**
+     * @brief Formats all solutions into text as a separate parallel stage.
+     *
+     * @tparam SourceType Random access Triplet source (std::vector, BinaryTripletReader, etc).
+     * @param triplets Equation coefficients, indexed by Triplet::id.
+     * @param solutions Numeric solutions, indexed by Triplet::id.
+     * @param threadCount Number of formatting threads.
+     * @return Text chunks in id order, concatenation gives all lines in input order.
+     */
+    template <typename SourceType>
+    std::vector<std::string> formatParallel(const SourceType& triplets,
+                                            const std::vector<utils::types::EquationSolution>& solutions,
+                                            uint32_t threadCount)
+    {
+        std::vector<std::string> chunks{};
+        formatParallel(triplets, solutions, 0, solutions.size(), threadCount, chunks);
+        return chunks;
+    }
+}
+
+#endif //PARALLEL_FORMATTER_H
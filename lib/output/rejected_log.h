@@ -0,0 +1,95 @@
+#ifndef REJECTED_LOG_H
+#define REJECTED_LOG_H
+
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace tektask::output
+{
+    /**
+     * @class RejectedLog
+     * @brief Hands positions of rejected input triplets from the parser to the ordered writer.
+     *
+     * A rejected triplet is logged as the id of the valid triplet following it, in input order.
+     * The producer logs rejections of a chunk before its ids are reserved in the reorder window,
+     * so the writer always knows them before it reaches the following id.
+     * Single producer and single consumer.
+     */
+    class RejectedLog
+    {
+    public:
+        RejectedLog() = default;
+        ~RejectedLog() = default;
+        RejectedLog(const RejectedLog&) = delete;
+        RejectedLog& operator=(const RejectedLog&) = delete;
+        RejectedLog(RejectedLog&&) = delete;
+        RejectedLog& operator=(RejectedLog&&) = delete;
+
+        /**
+         * @brief Appends rejections, producer side.
+         *
+         * @param ids Ids following rejected triplets, ascending, not less than previously added ones.
+         */
+        void add(const std::vector<int64_t>& ids)
+        {
+            if (ids.empty())
+            {
+                return;
+            }
+
+            std::lock_guard lock{m_mutex};
+            m_shared.insert(m_shared.end(), ids.begin(), ids.end());
+            m_added.store(m_added.load(std::memory_order_relaxed) + ids.size(), std::memory_order_release);
+        }
+
+        /**
+         * @brief Number of rejected triplets in front of the given id not taken yet, writer side.
+         *
+         * Takes them, so every rejection is counted once. Ids have to be asked for in ascending order,
+         * INT64_MAX takes everything left.
+         */
+        std::size_t take(int64_t id)
+        {
+            std::size_t count{0};
+            while (true)
+            {
+                if (m_next == m_local.size())
+                {
+                    // nothing new logged, the common case costs a single atomic load
+                    if (m_added.load(std::memory_order_acquire) == m_taken)
+                    {
+                        return count;
+                    }
+
+                    std::lock_guard lock{m_mutex};
+                    m_local.clear();
+                    m_local.swap(m_shared);
+                    m_taken += m_local.size();
+                    m_next = 0;
+                }
+
+                if (m_local[m_next] > id)
+                {
+                    return count;
+                }
+                ++m_next;
+                ++count;
+            }
+        }
+
+    private:
+        std::mutex m_mutex{};
+        std::vector<int64_t> m_shared{};
+        std::atomic<std::size_t> m_added{0};
+
+        // writer side
+        std::vector<int64_t> m_local{};
+        std::size_t m_next{0};
+        std::size_t m_taken{0};
+    };
+}
+
+#endif //REJECTED_LOG_H
@@ -0,0 +1,257 @@
+#ifndef REORDER_BUFFER_H
+#define REORDER_BUFFER_H
+
+#include "utils/constants/constants.h"
+#include "utils/types/types.h"
+
+#include <mutex>
+#include <memory>
+#include <atomic>
+#include <condition_variable>
+
+namespace tektask::output
+{
+    /**
+     * @class ReorderBuffer
+     * @brief Bounded reorder window, turns out of order solutions back into Triplet::id order.
+     *
+     * Three parties share the window:
+     * - producer reserves slots for the next ids, storing coefficients, and waits while the window is full;
+     * - resolvers write solutions by id, through operator[], and publish them;
+     * - writer drains the contiguous ready prefix as soon as it exists, freeing slots for the producer.
+     *
+     * Memory usage is bounded by the window size, no matter how long the input is.
+     * Producer and writer are expected to be single threads, resolvers can be many.
+     * If either of them fails, cancel() releases the other one.
+     */
+    class ReorderBuffer
+    {
+    public:
+        using value_type = utils::types::EquationSolution;
+
+        static constexpr std::size_t DEFAULT_WINDOW{64 * 1024};
+
+        /**
+         * @brief Constructs an empty window.
+         *
+         * @param window Number of slots, rounded up to a power of two.
+         */
+        explicit ReorderBuffer(std::size_t window = DEFAULT_WINDOW) :
+            m_window(_roundUp(window)),
+            m_mask(m_window - 1),
+            m_slots(std::make_unique<Slot[]>(m_window))
+        {
+        }
+
+        ~ReorderBuffer() = default;
+        ReorderBuffer(const ReorderBuffer&) = delete;
+        ReorderBuffer& operator=(const ReorderBuffer&) = delete;
+        ReorderBuffer(ReorderBuffer&&) = delete;
+        ReorderBuffer& operator=(ReorderBuffer&&) = delete;
+
+        [[nodiscard]] std::size_t window() const noexcept
+        {
+            return m_window;
+        }
+
+        /**
+         * @brief Reserves slots for consecutive triplets, producer side.
+         *
+         * Waits while triplets don't fit into the window, so count must not exceed window().
+         * Triplet ids have to continue the previously reserved ones, starting from 0.
+         *
+         * @param triplets Pointer to the first triplet.
+         * @param count Number of triplets.
+         * @return false if the window was cancelled, triplets may be reserved only partially then.
+         */
+        bool waitReserve(const utils::types::Triplet* triplets, std::size_t count)
+        {
+            if (m_cancelled.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const auto id{triplets[i].id};
+                if (id >= m_cachedHead + static_cast<int64_t>(m_window) && !_waitForRoom(id))
+                {
+                    return false;
+                }
+                m_slots[id & m_mask].triplet = triplets[i];
+            }
+            m_reserved += static_cast<int64_t>(count);
+            return true;
+        }
+
+        /**
+         * @brief Solution slot of a reserved id, resolver side.
+         */
+        value_type& operator[](std::size_t id) noexcept
+        {
+            return m_slots[id & m_mask].solution;
+        }
+
+        /**
+         * @brief Marks the solution of the id as ready for the writer, resolver side.
+         */
+        void publish(int64_t id) noexcept
+        {
+            m_slots[id & m_mask].ready.store(true);
+            if (m_awaitedId.value.load() == id)
+            {
+                std::lock_guard lock(m_mutex);
+                m_writerCv.notify_one();
+            }
+        }
+
+        /**
+         * @brief Signals that no more ids will be reserved, producer side.
+         */
+        void finish()
+        {
+            {
+                std::lock_guard lock(m_mutex);
+                m_total = m_reserved;
+                m_finished.store(true);
+            }
+            m_writerCv.notify_one();
+        }
+
+        /**
+         * @brief Gives up on the remaining ids after a failure, wakes the producer and the writer, any side.
+         *
+         * waitReserve() returns false from now on and drain() returns without waiting for unwritten ids.
+         */
+        void cancel()
+        {
+            {
+                std::lock_guard lock(m_mutex);
+                m_cancelled.store(true);
+            }
+            m_producerCv.notify_one();
+            m_writerCv.notify_one();
+        }
+
+        /**
+         * @brief Hands out solutions in id order until all reserved ids are written or cancel() is called, writer side.
+         *
+         * @param consume Called for every solution in id order, with its triplet.
+         * @param idle Called before waiting for the next solution, e.g. to flush buffered output.
+         */
+        template <typename Consumer, typename Idle>
+        void drain(Consumer&& consume, Idle&& idle)
+        {
+            int64_t head{0};
+            while (true)
+            {
+                Slot& slot{m_slots[head & m_mask]};
+                if (slot.ready.load(std::memory_order_acquire))
+                {
+                    consume(static_cast<const utils::types::Triplet&>(slot.triplet),
+                            static_cast<const value_type&>(slot.solution));
+                    slot.ready.store(false, std::memory_order_relaxed);
+                    _advanceHead(++head);
+                    continue;
+                }
+
+                if (m_cancelled.load() || (m_finished.load() && head == m_total))
+                {
+                    return;
+                }
+
+                idle();
+
+                m_awaitedId.value.store(head);
+                {
+                    std::unique_lock lock(m_mutex);
+                    m_writerCv.wait(lock, [&]
+                    {
+                        return slot.ready.load() || m_cancelled.load() || (m_finished.load() && head == m_total);
+                    });
+                }
+                m_awaitedId.value.store(NO_ID);
+            }
+        }
+
+    private:
+        static constexpr int64_t NO_ID{-1};
+
+        struct Slot
+        {
+            utils::types::Triplet triplet{};
+            value_type solution{};
+            std::atomic_bool ready{false};
+        };
+
+        struct alignas(utils::constants::CACHE_SIZE) PaddedId
+        {
+            std::atomic<int64_t> value{0};
+        };
+
+        static std::size_t _roundUp(std::size_t window) noexcept
+        {
+            std::size_t size{2};
+            while (size < window)
+            {
+                size *= 2;
+            }
+            return size;
+        }
+
+        void _advanceHead(int64_t head)
+        {
+            // seq_cst pairs with the waiting flag store of _waitForRoom(): a release store could be
+            // reordered after the flag load, the producer would then sleep on a stale head for good
+            m_head.value.store(head);
+            if (m_producerWaiting.value.load())
+            {
+                std::lock_guard lock(m_mutex);
+                m_producerCv.notify_one();
+            }
+        }
+
+        bool _waitForRoom(int64_t id)
+        {
+            m_cachedHead = m_head.value.load(std::memory_order_acquire);
+            if (id < m_cachedHead + static_cast<int64_t>(m_window))
+            {
+                return true;
+            }
+
+            m_producerWaiting.value.store(1);
+            {
+                std::unique_lock lock(m_mutex);
+                m_producerCv.wait(lock, [&]
+                {
+                    return m_cancelled.load() || id < m_head.value.load() + static_cast<int64_t>(m_window);
+                });
+            }
+            m_producerWaiting.value.store(0);
+            m_cachedHead = m_head.value.load(std::memory_order_acquire);
+            return id < m_cachedHead + static_cast<int64_t>(m_window);
+        }
+
+        const std::size_t m_window;
+        const std::size_t m_mask;
+        std::unique_ptr<Slot[]> m_slots;
+
+        // writer side
+        PaddedId m_head{};
+        PaddedId m_awaitedId{NO_ID};
+
+        // producer side
+        PaddedId m_producerWaiting{};
+        int64_t m_cachedHead{0};
+        int64_t m_reserved{0};
+        int64_t m_total{0};
+        std::atomic_bool m_finished{false};
+        std::atomic_bool m_cancelled{false};
+
+        std::mutex m_mutex;
+        std::condition_variable m_writerCv;
+        std::condition_variable m_producerCv;
+    };
+}
+
+#endif //REORDER_BUFFER_H
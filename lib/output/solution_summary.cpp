@@ -0,0 +1,92 @@
+#include "solution_summary.h"
+
+#include <string_view>
+
+
+namespace tektask::output
+{
+    using namespace tektask::utils::types;
+
+    namespace
+    {
+        // by SolveCase value
+        constexpr std::array<std::string_view, SolutionSummary::CASE_COUNT> CASE_NAMES{
+            "infinite roots", "no solution", "linear", "no real roots", "single root", "two roots",
+        };
+
+        /**
+         * @brief Bound of the bucket of values with binary exponent index - MIN_EXPONENT, clamped edges are open.
+         */
+        double exponentBound(std::size_t index) noexcept
+        {
+            if (index >= SolutionSummary::EXPONENT_COUNT)
+            {
+                return std::numeric_limits<double>::infinity();
+            }
+            if (index == 0)
+            {
+                return 0.0;
+            }
+            return std::ldexp(1.0, static_cast<int>(index) + SolutionSummary::MIN_EXPONENT);
+        }
+
+        /**
+         * @brief Prints the value range of a root bucket, like "[1, 2)", "0" or "(-2, -1]".
+         */
+        void printBucket(std::size_t bucket, std::ostream& out)
+        {
+            if (bucket == SolutionSummary::ZERO_BUCKET)
+            {
+                out << "0";
+                return;
+            }
+
+            if (bucket > SolutionSummary::ZERO_BUCKET)
+            {
+                const auto exponent{bucket - SolutionSummary::ZERO_BUCKET - 1};
+                out << '[' << exponentBound(exponent) << ", " << exponentBound(exponent + 1) << ')';
+                return;
+            }
+
+            const auto exponent{SolutionSummary::ZERO_BUCKET - 1 - bucket};
+            out << '(' << -exponentBound(exponent + 1) << ", " << -exponentBound(exponent) << ']';
+        }
+    }
+
+    void printSummary(const SolutionSummary& summary, std::ostream& out)
+    {
+        out << "equations: " << summary.equationCount() << '\n'
+            << "rejected: " << summary.rejectedCount() << '\n';
+        for (std::size_t kind = 0; kind < SolutionSummary::CASE_COUNT; ++kind)
+        {
+            out << CASE_NAMES[kind] << ": " << summary.count(static_cast<SolveCase>(kind)) << '\n';
+        }
+
+        if (summary.hasExtremum())
+        {
+            out << "Xmin: [" << summary.minXmin() << ", " << summary.maxXmin() << "]\n";
+        }
+        else
+        {
+            out << "Xmin: none\n";
+        }
+
+        uint64_t roots{0};
+        for (std::size_t bucket = 0; bucket < SolutionSummary::BUCKET_COUNT; ++bucket)
+        {
+            roots += summary.bucket(bucket);
+        }
+        out << "roots: " << roots << '\n';
+
+        for (std::size_t bucket = 0; bucket < SolutionSummary::BUCKET_COUNT; ++bucket)
+        {
+            if (summary.bucket(bucket) == 0)
+            {
+                continue;
+            }
+            out << "  ";
+            printBucket(bucket, out);
+            out << ": " << summary.bucket(bucket) << '\n';
+        }
+    }
+}
@@ -0,0 +1,290 @@
+#ifndef SOLUTION_SUMMARY_H
+#define SOLUTION_SUMMARY_H
+
+#include "utils/backoff/backoff.h"
+#include "utils/constants/constants.h"
+#include "utils/types/types.h"
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <atomic>
+#include <vector>
+#include <ostream>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+namespace tektask::output
+{
+    /**
+     * @class SolutionSummary
+     * @brief Aggregate statistics of solved equations: counts per solve case, Xmin range and a histogram of roots.
+     *
+     * Used as a resolver storage in aggregate mode, resolvers add solutions instead of
+     * storing them by id, so memory usage doesn't depend on input length.
+     * Root buckets are binary orders of magnitude, ascending by value: negative roots
+     * with |x| in [2^e, 2^(e+1)), zero, then positive ones. Roots of int64 coefficients
+     * stay within 2^-64..2^64, farther exponents are clamped to the edge buckets.
+     * Not thread-safe, every resolver adds into its own instance, instances are merged later.
+     */
+    class SolutionSummary
+    {
+    public:
+        // resolvers take summaries for structured result storages
+        using value_type = utils::types::EquationSolution;
+
+        static constexpr int MIN_EXPONENT{-64};
+        static constexpr int MAX_EXPONENT{64};
+        static constexpr std::size_t EXPONENT_COUNT{MAX_EXPONENT - MIN_EXPONENT + 1};
+        static constexpr std::size_t ZERO_BUCKET{EXPONENT_COUNT};
+        static constexpr std::size_t BUCKET_COUNT{2 * EXPONENT_COUNT + 1};
+        static constexpr std::size_t CASE_COUNT{static_cast<std::size_t>(utils::types::SolveCase::TwoRoots) + 1};
+
+        /**
+         * @brief Adds a solved equation.
+         */
+        void add(const utils::types::EquationSolution& solution) noexcept
+        {
+            using utils::types::SolveCase;
+
+            ++m_cases[static_cast<std::size_t>(solution.kind)];
+            switch (solution.kind)
+            {
+            case SolveCase::TwoRoots:
+                ++m_buckets[bucketOf(solution.x2)];
+                [[fallthrough]];
+            case SolveCase::SingleRoot:
+                ++m_buckets[bucketOf(solution.x1)];
+                _addExtremum(solution.xMin);
+                break;
+            case SolveCase::NoRealRoots:
+                _addExtremum(solution.xMin);
+                break;
+            case SolveCase::Linear:
+                ++m_buckets[bucketOf(solution.x1)];
+                break;
+            default:
+                break;
+            }
+        }
+
+        /**
+         * @brief Counts input triplets rejected by the parser.
+         */
+        void addRejected(uint64_t count) noexcept
+        {
+            m_rejected += count;
+        }
+
+        /**
+         * @brief Adds everything other summary holds.
+         */
+        void merge(const SolutionSummary& other) noexcept
+        {
+            for (std::size_t i = 0; i < CASE_COUNT; ++i)
+            {
+                m_cases[i] += other.m_cases[i];
+            }
+            for (std::size_t i = 0; i < BUCKET_COUNT; ++i)
+            {
+                m_buckets[i] += other.m_buckets[i];
+            }
+            m_rejected += other.m_rejected;
+            m_minXmin = std::min(m_minXmin, other.m_minXmin);
+            m_maxXmin = std::max(m_maxXmin, other.m_maxXmin);
+        }
+
+        /**
+         * @brief Root bucket of the value, see the class description.
+         */
+        static std::size_t bucketOf(double x) noexcept
+        {
+            if (x == 0.0)
+            {
+                return ZERO_BUCKET;
+            }
+
+            const auto exponent{static_cast<std::size_t>(std::clamp(std::ilogb(x), MIN_EXPONENT, MAX_EXPONENT) - MIN_EXPONENT)};
+            return x < 0.0 ? ZERO_BUCKET - 1 - exponent : ZERO_BUCKET + 1 + exponent;
+        }
+
+        [[nodiscard]] uint64_t count(utils::types::SolveCase kind) const noexcept
+        {
+            return m_cases[static_cast<std::size_t>(kind)];
+        }
+
+        /**
+         * @brief Number of solved equations, rejected triplets excluded.
+         */
+        [[nodiscard]] uint64_t equationCount() const noexcept
+        {
+            uint64_t total{0};
+            for (const auto count : m_cases)
+            {
+                total += count;
+            }
+            return total;
+        }
+
+        [[nodiscard]] uint64_t rejectedCount() const noexcept
+        {
+            return m_rejected;
+        }
+
+        [[nodiscard]] uint64_t bucket(std::size_t index) const noexcept
+        {
+            return m_buckets[index];
+        }
+
+        /**
+         * @brief true if any equation has an extremum, minXmin() and maxXmin() are meaningful only then.
+         */
+        [[nodiscard]] bool hasExtremum() const noexcept
+        {
+            return m_minXmin <= m_maxXmin;
+        }
+
+        [[nodiscard]] double minXmin() const noexcept
+        {
+            return m_minXmin;
+        }
+
+        [[nodiscard]] double maxXmin() const noexcept
+        {
+            return m_maxXmin;
+        }
+
+    private:
+        void _addExtremum(double xMin) noexcept
+        {
+            m_minXmin = std::min(m_minXmin, xMin);
+            m_maxXmin = std::max(m_maxXmin, xMin);
+        }
+
+        std::array<uint64_t, CASE_COUNT> m_cases{};
+        std::array<uint64_t, BUCKET_COUNT> m_buckets{};
+        uint64_t m_rejected{0};
+        double m_minXmin{std::numeric_limits<double>::infinity()};
+        double m_maxXmin{-std::numeric_limits<double>::infinity()};
+    };
+
+    /**
+     * @brief Prints the summary as "name: value" lines, followed by non-empty root buckets.
+     */
+    void printSummary(const SolutionSummary& summary, std::ostream& out);
+
+    /**
+     * @class ShardedSummary
+     * @brief Per-worker summaries merged by a parallel tree reduction.
+     *
+     * Every worker adds into its own cache line aligned shard. Once its resolver is done,
+     * a worker calls reduce(): in round r worker w, a multiple of 2^(r+1), waits for worker
+     * w + 2^r to finish and merges its shard, others publish their shard and leave.
+     * Workers only ever wait for larger indices, so the reduction can't deadlock, and
+     * shard 0 holds the total after log2(workers) rounds, once all workers returned.
+     * A worker holding a ReduceGuard reduces on every exit path, a failed worker
+     * included, so its partner never waits for it in vain.
+     */
+    class ShardedSummary
+    {
+    public:
+        /**
+         * @class ReduceGuard
+         * @brief Calls reduce() for the worker shard when it goes out of scope, whether the worker returned or threw.
+         */
+        class ReduceGuard
+        {
+        public:
+            ReduceGuard(ShardedSummary& summaries, std::size_t index) noexcept :
+                m_summaries(summaries),
+                m_index(index)
+            {
+            }
+
+            ~ReduceGuard()
+            {
+                m_summaries.reduce(m_index);
+            }
+
+            ReduceGuard(const ReduceGuard&) = delete;
+            ReduceGuard& operator=(const ReduceGuard&) = delete;
+            ReduceGuard(ReduceGuard&&) = delete;
+            ReduceGuard& operator=(ReduceGuard&&) = delete;
+
+        private:
+            ShardedSummary& m_summaries;
+            const std::size_t m_index;
+        };
+
+        /**
+         * @brief Constructs empty shards.
+         *
+         * @param shardCount Number of workers, at least one shard is created.
+         */
+        explicit ShardedSummary(std::size_t shardCount) :
+            m_shards(std::max<std::size_t>(shardCount, 1))
+        {
+        }
+
+        ~ShardedSummary() = default;
+        ShardedSummary(const ShardedSummary&) = delete;
+        ShardedSummary& operator=(const ShardedSummary&) = delete;
+        ShardedSummary(ShardedSummary&&) = delete;
+        ShardedSummary& operator=(ShardedSummary&&) = delete;
+
+        [[nodiscard]] SolutionSummary& shard(std::size_t index) noexcept
+        {
+            return m_shards[index].summary;
+        }
+
+        /**
+         * @brief Merges the shards the worker is responsible for into its own, then publishes it.
+         *
+         * Has to be called exactly once by every worker, see ReduceGuard.
+         */
+        void reduce(std::size_t index) noexcept
+        {
+            for (std::size_t stride = 1; stride < m_shards.size() && index % (2 * stride) == 0; stride *= 2)
+            {
+                const auto partner{index + stride};
+                if (partner >= m_shards.size())
+                {
+                    continue;
+                }
+
+                utils::backoff::Backoff backoff{};
+                while (!m_shards[partner].done.load(std::memory_order_acquire))
+                {
+                    backoff.pause();
+                }
+                m_shards[index].summary.merge(m_shards[partner].summary);
+            }
+            m_shards[index].done.store(true, std::memory_order_release);
+        }
+
+        /**
+         * @brief Summary of all shards, valid once every worker returned from reduce().
+         */
+        [[nodiscard]] SolutionSummary& total() noexcept
+        {
+            return m_shards.front().summary;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return m_shards.size();
+        }
+
+    private:
+        struct alignas(utils::constants::CACHE_SIZE) Shard
+        {
+            SolutionSummary summary{};
+            std::atomic_bool done{false};
+        };
+
+        std::vector<Shard> m_shards;
+    };
+}
+
+#endif //SOLUTION_SUMMARY_H
@@ -0,0 +1,144 @@
+#include "calibration.h"
+#include "cli/stream_parser.h"
+#include "resolver/quadratic_resolver.h"
+#include "thread/chunked_range.h"
+#include "thread/thread_pool.h"
+
+#include <array>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <algorithm>
+
+
+namespace tektask::planner
+{
+    using namespace tektask::utils::types;
+
+    namespace
+    {
+        constexpr std::size_t BENCH_TRIPLETS{16 * 1024};
+        constexpr int64_t BENCH_COEFFICIENT{1000};
+        constexpr int POOL_REPEATS{16};
+        constexpr int WORK_REPEATS{5};
+
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Shortest run time of the task in nanoseconds.
+         */
+        template <typename Task>
+        double bestOf(int repeats, Task&& task)
+        {
+            auto best{Clock::duration::max()};
+            for (int i = 0; i < repeats; ++i)
+            {
+                const auto start{Clock::now()};
+                task();
+                best = std::min(best, Clock::now() - start);
+            }
+            return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(best).count());
+        }
+
+        std::vector<Triplet> benchTriplets()
+        {
+            std::mt19937_64 engine{42};
+            std::uniform_int_distribution<int64_t> coefficient{-BENCH_COEFFICIENT, BENCH_COEFFICIENT};
+
+            std::vector<Triplet> triplets(BENCH_TRIPLETS);
+            for (std::size_t i = 0; i < triplets.size(); ++i)
+            {
+                triplets[i] = {coefficient(engine), coefficient(engine), coefficient(engine), static_cast<int64_t>(i)};
+            }
+            return triplets;
+        }
+
+        std::string benchText(const std::vector<Triplet>& triplets)
+        {
+            std::string text{};
+            for (const auto& t : triplets)
+            {
+                text += std::to_string(t.a) + ' ' + std::to_string(t.b) + ' ' + std::to_string(t.c) + '\n';
+            }
+            return text;
+        }
+    }
+
+    Calibration calibrate(uint32_t threadCount)
+    {
+        using Options = resolver::ResolverOptions<resolver::CoefficientRange::Full, false>;
+        using Input = thread::ChunkedRange<Triplet>;
+        using Resolver = resolver::QuadraticEquationResolver<Input, std::vector<EquationSolution>, Options>;
+
+        Calibration calibration{};
+        const auto workerCount{std::max<uint32_t>(threadCount - 1, 1)};
+        calibration.poolStartNs = bestOf(POOL_REPEATS, [workerCount]
+        {
+            thread::ThreadPool pool{workerCount};
+            pool.start([](uint32_t) {});
+            pool.wait();
+        });
+
+        const auto triplets{benchTriplets()};
+        std::vector<EquationSolution> solutions(triplets.size());
+        std::array<char, resolver::MAX_RESULT_LENGTH> line{};
+        // formatted text is dropped, the volatile store keeps formatting from being optimized away
+        volatile std::size_t printed{0};
+        const auto solveNs{bestOf(WORK_REPEATS, [&]
+        {
+            Input input{triplets.data(), triplets.size(), 1, resolver::SOLVE_BLOCK_SIZE};
+            Resolver resolver{input, solutions, nullptr};
+            resolver();
+            std::size_t length{0};
+            for (std::size_t i = 0; i < triplets.size(); ++i)
+            {
+                length += resolver::formatResult(line.data(), triplets[i], solutions[i]);
+            }
+            printed = length;
+        })};
+        calibration.solveNsPerTriplet = solveNs / static_cast<double>(triplets.size());
+
+        const auto text{benchText(triplets)};
+        std::vector<Triplet> parsed{};
+        const auto parseNs{bestOf(WORK_REPEATS, [&]
+        {
+            std::istringstream stream{text};
+            cli_parser::StreamParser parser{stream, PlannerConfig::MAX_SERIAL_BYTES, 1};
+            while (parser.next(parsed))
+            {
+            }
+        })};
+        calibration.parseNsPerByte = parseNs / static_cast<double>(text.size());
+        calibration.bytesPerTriplet = static_cast<double>(text.size()) / static_cast<double>(triplets.size());
+        return calibration;
+    }
+
+    PlannerConfig thresholds(const Calibration& calibration, uint32_t threadCount) noexcept
+    {
+        PlannerConfig config{MAX_SERIAL_TRIPLETS, PlannerConfig::MAX_SERIAL_BYTES};
+        if (threadCount <= 1)
+        {
+            return config;
+        }
+
+        const auto share{1.0 - 1.0 / threadCount};
+        const auto tripletCost{calibration.solveNsPerTriplet * share};
+        const auto byteCost{(calibration.parseNsPerByte +
+                             calibration.solveNsPerTriplet / std::max(calibration.bytesPerTriplet, 1.0)) * share};
+
+        // a zero cost never breaks even, the limits apply
+        if (tripletCost > 0.0)
+        {
+            config.serialMaxTriplets = static_cast<std::size_t>(
+                std::clamp(calibration.poolStartNs / tripletCost, 1.0, static_cast<double>(MAX_SERIAL_TRIPLETS)));
+        }
+        if (byteCost > 0.0)
+        {
+            config.serialMaxBytes = static_cast<std::size_t>(
+                std::clamp(calibration.poolStartNs / byteCost, 1.0, static_cast<double>(PlannerConfig::MAX_SERIAL_BYTES)));
+        }
+        return config;
+    }
+}
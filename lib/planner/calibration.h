@@ -0,0 +1,54 @@
+#ifndef CALIBRATION_H
+#define CALIBRATION_H
+
+#include "planner/execution_planner.h"
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace tektask::planner
+{
+    /**
+     * @struct Calibration
+     * @brief Costs measured by the built-in microbenchmark on the current machine.
+     */
+    struct Calibration
+    {
+        // starting the resolver pool, running an empty task on it and joining it
+        double poolStartNs{0.0};
+        // solving and formatting a single equation on one thread
+        double solveNsPerTriplet{0.0};
+        // parsing a single byte of text input on one thread
+        double parseNsPerByte{0.0};
+        // average text length of a triplet of the benchmark input
+        double bytesPerTriplet{0.0};
+    };
+
+    // triplets a serial job may have at most, whatever the calibration says
+    static constexpr std::size_t MAX_SERIAL_TRIPLETS{1024 * 1024};
+
+    /**
+     * @brief Runs the microbenchmark, takes a fraction of a second.
+     *
+     * Every cost is the best of a few repetitions, so background load on the machine
+     * inflates it less.
+     *
+     * @param threadCount Number of pipeline threads, the calling thread included.
+     */
+    Calibration calibrate(uint32_t threadCount);
+
+    /**
+     * @brief Input sizes at which the serial and the parallel plan take the same time.
+     *
+     * A serial job takes n * cost, a parallel one poolStart + n * cost / threadCount,
+     * they break even at n = poolStart / (cost * (1 - 1 / threadCount)). With a single
+     * thread nothing is gained in parallel, serial thresholds are the largest allowed.
+     *
+     * @param calibration Measured costs.
+     * @param threadCount Number of pipeline threads, the calling thread included.
+     */
+    PlannerConfig thresholds(const Calibration& calibration, uint32_t threadCount) noexcept;
+}
+
+#endif //CALIBRATION_H
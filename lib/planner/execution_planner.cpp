@@ -0,0 +1,199 @@
+#include "execution_planner.h"
+#include "io/binary_triplets.h"
+
+#include <cstdio>
+#include <algorithm>
+#include <cstdlib>
+#include <charconv>
+#include <fstream>
+#include <stdexcept>
+#include <filesystem>
+#include <string_view>
+
+#include <unistd.h>
+#include <sys/stat.h>
+
+
+namespace tektask::planner
+{
+    using namespace tektask::utils::types;
+
+    namespace
+    {
+        constexpr std::string_view SERIAL_MAX_TRIPLETS_KEY{"serial_max_triplets"};
+        constexpr std::string_view SERIAL_MAX_BYTES_KEY{"serial_max_bytes"};
+
+        std::string_view trim(std::string_view text) noexcept
+        {
+            constexpr std::string_view SPACES{" \t\r"};
+            const auto first{text.find_first_not_of(SPACES)};
+            if (first == std::string_view::npos)
+            {
+                return {};
+            }
+            return text.substr(first, text.find_last_not_of(SPACES) - first + 1);
+        }
+
+        /**
+         * @brief Size of a regular file, or of its part after the current offset of the descriptor.
+         *
+         * @return false if the size is unknown up front, like for a pipe.
+         */
+        bool regularFileSize(const struct stat& info, off_t offset, std::size_t& size) noexcept
+        {
+            if (!S_ISREG(info.st_mode))
+            {
+                return false;
+            }
+            size = static_cast<std::size_t>(info.st_size > offset ? info.st_size - offset : 0);
+            return true;
+        }
+    }
+
+    JobSize measureJob(const CliArgs& params)
+    {
+        JobSize job{};
+        if (params.inputPath.empty())
+        {
+            job.triplets = params.triplets.size();
+            return job;
+        }
+
+        struct stat info{};
+        std::size_t size{0};
+        if (params.inputPath == "-")
+        {
+            const auto offset{::lseek(STDIN_FILENO, 0, SEEK_CUR)};
+            job.unbounded = ::fstat(STDIN_FILENO, &info) != 0 || !regularFileSize(info, std::max<off_t>(offset, 0), size);
+        }
+        else
+        {
+            // a missing file is reported when the input is opened
+            job.unbounded = ::stat(params.inputPath.c_str(), &info) != 0 || !regularFileSize(info, 0, size);
+        }
+
+        if (params.inputFormat == InputFormat::Binary)
+        {
+            const auto records{size > io::BINARY_TRIPLETS_HEADER_SIZE ? size - io::BINARY_TRIPLETS_HEADER_SIZE : 0};
+            job.triplets = records / io::BINARY_TRIPLETS_RECORD_SIZE;
+            job.unbounded = false;
+            return job;
+        }
+
+        job.text = true;
+        job.bytes = size;
+        return job;
+    }
+
+    PlannerConfig PlannerConfig::load(const std::string& path)
+    {
+        PlannerConfig config{};
+        std::ifstream file{path};
+        if (!file)
+        {
+            return config;
+        }
+
+        std::string line{};
+        for (std::size_t number = 1; std::getline(file, line); ++number)
+        {
+            auto text{std::string_view{line}.substr(0, line.find('#'))};
+            text = trim(text);
+            if (text.empty())
+            {
+                continue;
+            }
+
+            const auto separator{text.find('=')};
+            const auto key{trim(text.substr(0, separator))};
+            const auto value{separator == std::string_view::npos ? std::string_view{} : trim(text.substr(separator + 1))};
+
+            std::size_t parsed{0};
+            const char* end{value.data() + value.size()};
+            const auto result{std::from_chars(value.data(), end, parsed)};
+            if (value.empty() || result.ec != std::errc{} || result.ptr != end)
+            {
+                throw std::invalid_argument("Invalid input: malformed planner config " + path + " line " +
+                                            std::to_string(number));
+            }
+
+            // keys of other versions are skipped
+            if (key == SERIAL_MAX_TRIPLETS_KEY)
+            {
+                config.serialMaxTriplets = parsed;
+            }
+            else if (key == SERIAL_MAX_BYTES_KEY)
+            {
+                config.serialMaxBytes = parsed;
+            }
+        }
+        return config;
+    }
+
+    void PlannerConfig::save(const std::string& path) const
+    {
+        const std::filesystem::path target{path};
+        std::error_code error{};
+        if (target.has_parent_path())
+        {
+            std::filesystem::create_directories(target.parent_path(), error);
+        }
+
+        // solvers started meanwhile read either the old file or the new one, never a partial one
+        const auto temporary{path + ".tmp"};
+        {
+            std::ofstream file{temporary, std::ios::trunc};
+            file << "# se_solver execution planner thresholds, written by --calibrate\n"
+                 << SERIAL_MAX_TRIPLETS_KEY << '=' << serialMaxTriplets << '\n'
+                 << SERIAL_MAX_BYTES_KEY << '=' << serialMaxBytes << '\n';
+            file.flush();
+            if (!file)
+            {
+                throw std::runtime_error("Invalid input: failed to write planner config " + path);
+            }
+        }
+
+        if (std::rename(temporary.c_str(), path.c_str()) != 0)
+        {
+            std::remove(temporary.c_str());
+            throw std::runtime_error("Invalid input: failed to write planner config " + path);
+        }
+    }
+
+    std::string defaultConfigPath()
+    {
+        if (const char* config{std::getenv("XDG_CONFIG_HOME")}; config != nullptr && *config != '\0')
+        {
+            return std::string{config} + "/se_solver/planner.conf";
+        }
+        if (const char* home{std::getenv("HOME")}; home != nullptr && *home != '\0')
+        {
+            return std::string{home} + "/.config/se_solver/planner.conf";
+        }
+        return {};
+    }
+
+    ExecutionPlan ExecutionPlanner::plan(const JobSize& job, ExecutionMode mode) const noexcept
+    {
+        if (mode == ExecutionMode::Serial)
+        {
+            return ExecutionPlan::Serial;
+        }
+
+        const auto parallel{job.text ? ExecutionPlan::Streaming : ExecutionPlan::Chunked};
+        if (mode == ExecutionMode::Parallel)
+        {
+            return parallel;
+        }
+
+        if (job.text)
+        {
+            // the size of a pipe is known only once it is read, so it's streamed in bounded memory
+            const auto maxBytes{std::min(m_config.serialMaxBytes, PlannerConfig::MAX_SERIAL_BYTES)};
+            return !job.unbounded && job.bytes <= maxBytes ? ExecutionPlan::Serial : parallel;
+        }
+
+        // a single thread gains nothing from a pool worker, the calling thread would just wait for it
+        return m_threadCount <= 1 || job.triplets <= m_config.serialMaxTriplets ? ExecutionPlan::Serial : parallel;
+    }
+}
@@ -0,0 +1,131 @@
+#ifndef EXECUTION_PLANNER_H
+#define EXECUTION_PLANNER_H
+
+#include "utils/types/types.h"
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace tektask::planner
+{
+    /**
+     * @enum ExecutionPlan
+     * @brief How a job is executed.
+     */
+    enum class ExecutionPlan : uint8_t
+    {
+        Serial,    ///< parsed, solved and printed on the calling thread, no threads are started
+        Chunked,   ///< in-memory input, resolver pool claims chunks of it
+        Streaming, ///< text input, parsing, solving and printing go in parallel through bounded queues
+    };
+
+    /**
+     * @struct JobSize
+     * @brief Size of the job input, as far as it is known before parsing.
+     */
+    struct JobSize
+    {
+        // triplets known up front: command line coefficients or binary records
+        std::size_t triplets{0};
+        // text input size in bytes
+        std::size_t bytes{0};
+        // input is text, parsed while it is read
+        bool text{false};
+        // text input of unknown size, like a pipe or a terminal
+        bool unbounded{false};
+    };
+
+    /**
+     * @brief Measures the job input described by the command line, files are only stat-ed.
+     *
+     * stdin redirected from a regular file counts as a text input of the remaining file size.
+     */
+    JobSize measureJob(const utils::types::CliArgs& params);
+
+    /**
+     * @struct PlannerConfig
+     * @brief Input sizes up to which a job is cheaper to run on the calling thread than to start the pool.
+     *
+     * Stored as "key=value" lines, '#' starts a comment. Defaults fit a desktop machine,
+     * --calibrate replaces them with values measured on the current one.
+     */
+    struct PlannerConfig
+    {
+        static constexpr std::size_t DEFAULT_SERIAL_MAX_TRIPLETS{4 * 1024};
+        static constexpr std::size_t DEFAULT_SERIAL_MAX_BYTES{64 * 1024};
+        // serial text input is parsed as a single stream parser chunk, so diagnostics are printed in front of results
+        static constexpr std::size_t MAX_SERIAL_BYTES{256 * 1024};
+
+        std::size_t serialMaxTriplets{DEFAULT_SERIAL_MAX_TRIPLETS};
+        std::size_t serialMaxBytes{DEFAULT_SERIAL_MAX_BYTES};
+
+        /**
+         * @brief Reads the config file, a missing file gives the defaults, missing keys keep theirs.
+         *
+         * @throws if the file is malformed.
+         */
+        static PlannerConfig load(const std::string& path);
+
+        /**
+         * @brief Writes the config file, creating its directory, the file is replaced atomically.
+         *
+         * @throws if the file can't be written.
+         */
+        void save(const std::string& path) const;
+    };
+
+    /**
+     * @brief Default config file path, $XDG_CONFIG_HOME/se_solver/planner.conf or ~/.config/se_solver/planner.conf.
+     *
+     * @return Empty string if neither variable is set.
+     */
+    std::string defaultConfigPath();
+
+    /**
+     * @class ExecutionPlanner
+     * @brief Picks the execution plan of a job by its input size and source.
+     *
+     * Small inputs are solved on the calling thread, starting and joining the pool would
+     * take longer than the work itself. Larger in-memory inputs are split between the
+     * pool workers, larger or unbounded text inputs go through the streaming pipeline,
+     * which keeps memory usage independent of input length.
+     */
+    class ExecutionPlanner
+    {
+    public:
+        /**
+         * @brief Constructs a planner.
+         *
+         * @param config Serial thresholds.
+         * @param threadCount Number of pipeline threads, the calling thread included.
+         */
+        ExecutionPlanner(PlannerConfig config, uint32_t threadCount) noexcept :
+            m_config(config),
+            m_threadCount(threadCount)
+        {
+        }
+
+        ~ExecutionPlanner() = default;
+        ExecutionPlanner(const ExecutionPlanner&) = default;
+        ExecutionPlanner& operator=(const ExecutionPlanner&) = default;
+        ExecutionPlanner(ExecutionPlanner&&) noexcept = default;
+        ExecutionPlanner& operator=(ExecutionPlanner&&) noexcept = default;
+
+        /**
+         * @brief Picks the plan of the job.
+         *
+         * @param job Input size.
+         * @param mode Auto lets the thresholds decide, Serial and Parallel force the plan kind.
+         */
+        [[nodiscard]] ExecutionPlan plan(const JobSize& job,
+                                         utils::types::ExecutionMode mode = utils::types::ExecutionMode::Auto) const noexcept;
+
+    private:
+        PlannerConfig m_config;
+        uint32_t m_threadCount{1};
+    };
+}
+
+#endif //EXECUTION_PLANNER_H
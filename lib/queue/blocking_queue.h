@@ -1,84 +1,181 @@
 #ifndef BLOCKING_QUEUE_H
 #define BLOCKING_QUEUE_H
 
-#include <queue>
+#include "stats/stats.h"
+
 #include <mutex>
+#include <chrono>
+#include <memory>
+#include <vector>
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
 #include <condition_variable>
 
 namespace tektask::queue
 {
+    /**
+     * @enum ShutdownMode
+     * @brief What happens to the items left in a queue on shutdown.
+     */
+    enum class ShutdownMode : uint8_t
+    {
+        Drain, ///< consumers pop the remaining items, then get false
+        Abort, ///< remaining items are dropped, consumers get false right away
+    };
+
     /**
      * @class BlockingQueue
-     * @brief Thread-safe blocking queue with support for graceful shutdown.
+     * @brief Bounded thread-safe blocking queue with support for graceful shutdown.
      *
-     * Provides a classical FIFO queue with blocking semantics.
+     * Provides a classical FIFO queue with blocking semantics over a ring buffer
+     * preallocated at construction, pushes and pops never allocate.
      *
-     * waitPush() blocks if needed while acquiring the lock;
+     * waitPush() blocks while the queue is full, so a fast producer is held back
+     * by its consumers instead of growing a backlog;
      * waitPop() blocks until data is available or shutdown is triggered.
+     * Batch variants amortize locking and notifications over many small items.
+     * try variants never block, waitPopFor() blocks up to a timeout.
+     * Contended locks and waits on an empty or full queue are counted by stats.
+     *
+     * Resolver queues (BlockingQueue, LockFreeQueue, WorkStealingQueue) are interchangeable
+     * and share this contract:
+     * - waitPush() and waitPushBatch() wait for room and return false once shutdown() was
+     *   called, a batch may be pushed partially then;
+     * - waitPop() and waitPopBatch() wait for items, after shutdown() they take the items
+     *   pushed before it and then return false or 0;
+     * - shutdown() wakes all waiting producers and consumers, a push racing with it may
+     *   either fail or land in the queue, so the producer is expected to shut it down.
      *
-     * @tparam T Type of the elements stored in the queue.
+     * @tparam T Type of the elements stored in the queue, default constructible.
      */
     template <typename T>
     class BlockingQueue
     {
     public:
-        BlockingQueue() = default;
+        static constexpr std::size_t DEFAULT_CAPACITY{64 * 1024};
+
+        /**
+         * @brief Constructs an empty queue with preallocated slots.
+         *
+         * @param capacity Maximum number of queued items.
+         *
+         * @throws if capacity is zero.
+         */
+        explicit BlockingQueue(std::size_t capacity = DEFAULT_CAPACITY) :
+            m_items(std::make_unique<T[]>(_checkedCapacity(capacity))),
+            m_capacity(capacity)
+        {
+        }
+
         ~BlockingQueue() = default;
         BlockingQueue(const BlockingQueue&) = delete;
         BlockingQueue& operator=(const BlockingQueue&) = delete;
+        BlockingQueue(BlockingQueue&&) = delete;
+        BlockingQueue& operator=(BlockingQueue&&) = delete;
+
+        using value_type = T;
 
-        BlockingQueue(BlockingQueue&& other) noexcept : m_queue(std::move(other.m_queue)),
-                                                        m_mutex(std::move(other.m_mutex)), m_cv(std::move(other.m_cv)),
-                                                        m_stopped(std::move(other.m_stopped))
+        /**
+         * @brief Pushes a copy of the item into the queue.
+         *
+         * Waits while the queue is full, notifies one waiting consumer thread.
+         *
+         * @param item The item to be pushed.
+         * @return true if the item was pushed, false if the queue was shut down.
+         */
+        bool waitPush(const T& item)
         {
+            T copy{item};
+            return waitPush(std::move(copy));
         }
 
-        BlockingQueue& operator=(BlockingQueue&& other)
+        /**
+         * @brief Pushes a moved item into the queue.
+         *
+         * Waits while the queue is full, notifies one waiting consumer thread.
+         *
+         * @param item The item to be moved.
+         * @return true if the item was pushed, false if the queue was shut down.
+         */
+        bool waitPush(T&& item)
         {
-            if (this == &other)
             {
-                return *this;
+                auto lock{_lock()};
+                if (!_waitNotFull(lock))
+                {
+                    return false;
+                }
+                _push(std::move(item));
             }
-            m_queue = std::move(other.m_queue);
-            m_mutex = std::move(other.m_mutex);
-            m_cv = std::move(other.m_cv);
-            m_stopped = std::move(other.m_stopped);
-            return *this;
+            m_notEmpty.notify_one();
+            return true;
         }
 
-        using value_type = T;
-
         /**
-         * @brief Pushes a copy of the item into the queue.
+         * @brief Pushes copies of a range of items into the queue, as many per lock as there is room for.
          *
-         * Notifies one waiting consumer thread.
+         * Waits while the queue is full, notifies all waiting consumer threads once per
+         * filled stretch, instead of a notification per item.
+         * Wrap iterators with std::make_move_iterator to move items instead.
          *
-         * @param item The item to be pushed.
+         * @param first Iterator to the first item.
+         * @param last Iterator past the last item.
+         * @return true if all items were pushed, false if the queue was shut down first.
          */
-        void waitPush(const T& item)
+        template <typename InputIt>
+        bool waitPushBatch(InputIt first, InputIt last)
         {
+            while (first != last)
             {
-                std::lock_guard lock(m_mutex);
-                m_queue.push(item);
+                {
+                    auto lock{_lock()};
+                    if (!_waitNotFull(lock))
+                    {
+                        return false;
+                    }
+                    for (; first != last && m_size < m_capacity; ++first)
+                    {
+                        _push(*first);
+                    }
+                }
+                m_notEmpty.notify_all();
             }
-            m_cv.notify_one();
+            return true;
         }
 
         /**
-         * @brief Pushes a moved item into the queue.
+         * @brief Tries to push the item without waiting.
          *
-         * Notifies one waiting consumer thread.
-         *
-         * @param item The item to be moved.
+         * @param item The item to be moved, left untouched if it wasn't pushed.
+         * @return true if the item was pushed, false if the queue is full or was shut down.
          */
-        void waitPush(T&& item)
+        bool tryPush(T&& item)
         {
             {
-                std::lock_guard lock(m_mutex);
-                m_queue.push(std::move(item));
+                auto lock{_lock()};
+                if (m_stopped || m_size == m_capacity)
+                {
+                    return false;
+                }
+                _push(std::move(item));
             }
-            m_cv.notify_one();
+            m_notEmpty.notify_one();
+            return true;
+        }
+
+        /**
+         * @brief Tries to push a copy of the item without waiting.
+         *
+         * @return true if the item was pushed, false if the queue is full or was shut down.
+         */
+        bool tryPush(const T& item)
+        {
+            T copy{item};
+            return tryPush(std::move(copy));
         }
 
         /**
@@ -91,41 +188,222 @@ namespace tektask::queue
          */
         bool waitPop(T& out)
         {
-            std::unique_lock lock(m_mutex);
-            m_cv.wait(lock, [&]
+            auto lock{_lock()};
+            _waitNotEmpty(lock);
+            return _popOne(lock, out);
+        }
+
+        /**
+         * @brief Pops an item from the queue, waiting no longer than the timeout.
+         *
+         * @param out Reference to store the dequeued item.
+         * @param timeout Maximum time to wait for an item.
+         * @return true if an item was popped, false on timeout or if shutdown and the queue was empty.
+         */
+        template <typename Rep, typename Period>
+        bool waitPopFor(T& out, const std::chrono::duration<Rep, Period>& timeout)
+        {
+            auto lock{_lock()};
+            if (m_size == 0 && !m_stopped)
             {
-                return !m_queue.empty() || m_stopped;
-            });
+                stats::count(stats::Counter::EmptyQueueWaits);
+                m_notEmpty.wait_for(lock, timeout, [&]
+                {
+                    return m_size != 0 || m_stopped;
+                });
+            }
+            return _popOne(lock, out);
+        }
+
+        /**
+         * @brief Tries to pop an item without waiting.
+         *
+         * @param out Reference to store the dequeued item.
+         * @return true if an item was popped, false if the queue is empty.
+         */
+        bool tryPop(T& out)
+        {
+            auto lock{_lock()};
+            return _popOne(lock, out);
+        }
 
-            if (m_stopped && m_queue.empty())
+        /**
+         * @brief Pops up to maxCount items from the queue under a single lock.
+         *
+         * Waits until at least one item is available or shutdown was triggered.
+         *
+         * @param out Cleared and filled with the dequeued items.
+         * @param maxCount Maximum number of items to pop.
+         * @return Number of popped items, 0 if shutdown and the queue was empty.
+         */
+        std::size_t waitPopBatch(std::vector<T>& out, std::size_t maxCount)
+        {
+            out.clear();
+            if (maxCount == 0)
             {
-                return false;
+                return 0;
             }
 
-            out = std::move(m_queue.front());
-            m_queue.pop();
-            return true;
+            {
+                auto lock{_lock()};
+                _waitNotEmpty(lock);
+
+                const auto count{std::min(m_size, maxCount)};
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    out.emplace_back(_pop());
+                }
+            }
+
+            if (!out.empty())
+            {
+                m_notFull.notify_all();
+            }
+            return out.size();
         }
 
         /**
          * @brief Signals all waiting threads to stop.
          *
-         * After calling shutdown, all waiting waitPop() calls will return false.
+         * Pushes fail from now on, producers waiting for room give up.
+         * With ShutdownMode::Drain waitPop() calls drain the remaining items and then return false,
+         * with ShutdownMode::Abort the remaining items are dropped and waitPop() calls return false at once.
+         *
+         * @param mode What happens to the items left in the queue.
          */
-        void shutdown()
+        void shutdown(ShutdownMode mode = ShutdownMode::Drain)
         {
             {
                 std::lock_guard lock(m_mutex);
                 m_stopped = true;
+                if (mode == ShutdownMode::Abort)
+                {
+                    while (m_size != 0)
+                    {
+                        _pop();
+                    }
+                }
             }
-            m_cv.notify_all();
+            m_notEmpty.notify_all();
+            m_notFull.notify_all();
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept
+        {
+            return m_capacity;
         }
 
     private:
-        std::queue<T> m_queue;
+        static std::size_t _checkedCapacity(std::size_t capacity)
+        {
+            if (capacity == 0)
+            {
+                throw std::invalid_argument("Blocking queue capacity must be positive");
+            }
+            return capacity;
+        }
+
+        /**
+         * @brief Acquires the queue lock, counting contended acquisitions.
+         */
+        std::unique_lock<std::mutex> _lock()
+        {
+            std::unique_lock lock(m_mutex, std::try_to_lock);
+            if (!lock.owns_lock())
+            {
+                stats::count(stats::Counter::LockWaits);
+                lock.lock();
+            }
+            return lock;
+        }
+
+        /**
+         * @brief Waits until an item is available or shutdown was triggered, counting actual waits.
+         */
+        void _waitNotEmpty(std::unique_lock<std::mutex>& lock)
+        {
+            if (m_size != 0 || m_stopped)
+            {
+                return;
+            }
+
+            stats::count(stats::Counter::EmptyQueueWaits);
+            m_notEmpty.wait(lock, [&]
+            {
+                return m_size != 0 || m_stopped;
+            });
+        }
+
+        /**
+         * @brief Waits until there is room for an item or shutdown was triggered, counting actual waits.
+         *
+         * @return true if there is room, false if shutdown.
+         */
+        bool _waitNotFull(std::unique_lock<std::mutex>& lock)
+        {
+            if (m_size == m_capacity && !m_stopped)
+            {
+                stats::count(stats::Counter::FullQueueWaits);
+                m_notFull.wait(lock, [&]
+                {
+                    return m_size < m_capacity || m_stopped;
+                });
+            }
+            return !m_stopped;
+        }
+
+        /**
+         * @brief Pops a single item if there is one and wakes a waiting producer, releases the lock.
+         */
+        bool _popOne(std::unique_lock<std::mutex>& lock, T& out)
+        {
+            if (m_size == 0)
+            {
+                return false;
+            }
+
+            out = _pop();
+            lock.unlock();
+            m_notFull.notify_one();
+            return true;
+        }
+
+        template <typename U>
+        void _push(U&& item)
+        {
+            auto tail{m_head + m_size};
+            if (tail >= m_capacity)
+            {
+                tail -= m_capacity;
+            }
+            m_items[tail] = std::forward<U>(item);
+            ++m_size;
+        }
+
+        T _pop()
+        {
+            T item{std::move(m_items[m_head])};
+            if constexpr (!std::is_trivially_copyable_v<T>)
+            {
+                // don't keep resources of popped items alive in the ring
+                m_items[m_head] = T{};
+            }
+            if (++m_head == m_capacity)
+            {
+                m_head = 0;
+            }
+            --m_size;
+            return item;
+        }
+
+        std::unique_ptr<T[]> m_items;
+        const std::size_t m_capacity;
+        std::size_t m_head{0};
+        std::size_t m_size{0};
         std::mutex m_mutex;
-        std::condition_variable m_cv;
-        std::atomic_bool m_stopped{false};
+        std::condition_variable m_notEmpty;
+        std::condition_variable m_notFull;
+        bool m_stopped{false};
     };
 }
 
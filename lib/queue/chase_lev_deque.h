@@ -0,0 +1,166 @@
+#ifndef CHASE_LEV_DEQUE_H
+#define CHASE_LEV_DEQUE_H
+
+#include "utils/constants/constants.h"
+
+#include <memory>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+namespace tektask::queue
+{
+    /**
+     * @class ChaseLevDeque
+     * @brief Bounded Chase-Lev work-stealing deque.
+     *
+     * The owner thread pushes and pops items at the bottom end, LIFO, any other
+     * thread steals them from the top end, FIFO. Owner operations are plain loads
+     * and stores except for the race on the very last item, thieves claim an item
+     * with a single CAS on top. Memory ordering follows Le, Pop, Cohen and Nardelli,
+     * "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013).
+     *
+     * The ring doesn't grow, push() reports a full deque instead.
+     *
+     * @tparam T Trivially copyable item type, usually a pointer to a task.
+     */
+    template <typename T>
+    class ChaseLevDeque
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Deque items are copied through atomics");
+
+    public:
+        static constexpr std::size_t DEFAULT_CAPACITY{1024};
+
+        /**
+         * @brief Constructs an empty deque with preallocated slots.
+         *
+         * @param capacity Number of slots, must be a power of two.
+         *
+         * @throws if capacity isn't a power of two.
+         */
+        explicit ChaseLevDeque(std::size_t capacity = DEFAULT_CAPACITY) :
+            m_slots(std::make_unique<std::atomic<T>[]>(_checkedCapacity(capacity))),
+            m_mask(static_cast<int64_t>(capacity - 1))
+        {
+        }
+
+        ~ChaseLevDeque() = default;
+        ChaseLevDeque(const ChaseLevDeque&) = delete;
+        ChaseLevDeque& operator=(const ChaseLevDeque&) = delete;
+        ChaseLevDeque(ChaseLevDeque&&) = delete;
+        ChaseLevDeque& operator=(ChaseLevDeque&&) = delete;
+
+        /**
+         * @brief Pushes an item at the bottom, owner only.
+         *
+         * @return true if the item was pushed, false if the deque is full.
+         */
+        bool push(T item) noexcept
+        {
+            const auto bottom{m_bottom.value.load(std::memory_order_relaxed)};
+            const auto top{m_top.value.load(std::memory_order_acquire)};
+            if (bottom - top > m_mask)
+            {
+                return false;
+            }
+
+            m_slots[bottom & m_mask].store(item, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_bottom.value.store(bottom + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        /**
+         * @brief Pops the most recently pushed item, owner only.
+         *
+         * @param out Reference to store the item.
+         * @return true if an item was popped, false if the deque is empty or the last item was stolen.
+         */
+        bool pop(T& out) noexcept
+        {
+            const auto bottom{m_bottom.value.load(std::memory_order_relaxed) - 1};
+            m_bottom.value.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto top{m_top.value.load(std::memory_order_relaxed)};
+
+            if (top > bottom)
+            {
+                m_bottom.value.store(bottom + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            out = m_slots[bottom & m_mask].load(std::memory_order_relaxed);
+            if (top < bottom)
+            {
+                return true;
+            }
+
+            // the last item, race thieves for it
+            const auto won{m_top.value.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                               std::memory_order_relaxed)};
+            m_bottom.value.store(bottom + 1, std::memory_order_relaxed);
+            return won;
+        }
+
+        /**
+         * @brief Steals the least recently pushed item, any thread.
+         *
+         * @param out Reference to store the item.
+         * @return true if an item was stolen, false if the deque is empty or another thread won the item.
+         */
+        bool steal(T& out) noexcept
+        {
+            auto top{m_top.value.load(std::memory_order_acquire)};
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const auto bottom{m_bottom.value.load(std::memory_order_acquire)};
+            if (top >= bottom)
+            {
+                return false;
+            }
+
+            out = m_slots[top & m_mask].load(std::memory_order_relaxed);
+            return m_top.value.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                       std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Approximate number of items, exact when no other thread touches the deque.
+         */
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            const auto bottom{m_bottom.value.load(std::memory_order_seq_cst)};
+            const auto top{m_top.value.load(std::memory_order_seq_cst)};
+            return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept
+        {
+            return static_cast<std::size_t>(m_mask + 1);
+        }
+
+    private:
+        static std::size_t _checkedCapacity(std::size_t capacity)
+        {
+            if (capacity < 2 || (capacity & (capacity - 1)) != 0)
+            {
+                throw std::invalid_argument("Work-stealing deque capacity must be a power of two");
+            }
+            return capacity;
+        }
+
+        struct alignas(utils::constants::CACHE_SIZE) PaddedIndex
+        {
+            std::atomic<int64_t> value{0};
+        };
+
+        std::unique_ptr<std::atomic<T>[]> m_slots;
+        const int64_t m_mask;
+        PaddedIndex m_top{};
+        PaddedIndex m_bottom{};
+    };
+}
+
+#endif //CHASE_LEV_DEQUE_H
@@ -0,0 +1,291 @@
+#ifndef LOCK_FREE_QUEUE_H
+#define LOCK_FREE_QUEUE_H
+
+#include "utils/backoff/backoff.h"
+#include "utils/constants/constants.h"
+
+#include <memory>
+#include <vector>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace tektask::queue
+{
+    /**
+     * @class LockFreeQueue
+     * @brief Bounded lock-free MPMC queue with support for graceful shutdown.
+     *
+     * Ring buffer of sequence-numbered cells (Dmitry Vyukov's MPMC queue): producers and
+     * consumers claim positions with a CAS on separate cache-line padded counters, cell
+     * sequence numbers tell whether a cell is ready to be written or read.
+     * No locks and no notifications are involved, waiting threads spin and then yield.
+     *
+     * waitPush() waits while the queue is full, push and shutdown semantics follow
+     * the resolver queue contract described at BlockingQueue.
+     *
+     * @tparam T Type of the elements stored in the queue.
+     */
+    template <typename T>
+    class LockFreeQueue
+    {
+    public:
+        static constexpr std::size_t DEFAULT_CAPACITY{64 * 1024};
+
+        /**
+         * @brief Constructs a queue with preallocated cells.
+         *
+         * @param capacity Number of cells, must be a power of two.
+         *
+         * @throws if capacity isn't a power of two.
+         */
+        explicit LockFreeQueue(std::size_t capacity = DEFAULT_CAPACITY) :
+            m_cells(std::make_unique<Cell[]>(_checkedCapacity(capacity))),
+            m_mask(capacity - 1)
+        {
+            for (std::size_t i = 0; i < capacity; ++i)
+            {
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        ~LockFreeQueue() = default;
+        LockFreeQueue(const LockFreeQueue&) = delete;
+        LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+        LockFreeQueue(LockFreeQueue&&) = delete;
+        LockFreeQueue& operator=(LockFreeQueue&&) = delete;
+
+        using value_type = T;
+
+        /**
+         * @brief Pushes a copy of the item into the queue.
+         *
+         * Waits while the queue is full.
+         *
+         * @param item The item to be pushed.
+         * @return true if the item was pushed, false if the queue was shut down.
+         */
+        bool waitPush(const T& item)
+        {
+            T copy{item};
+            return waitPush(std::move(copy));
+        }
+
+        /**
+         * @brief Pushes a moved item into the queue.
+         *
+         * Waits while the queue is full.
+         *
+         * @param item The item to be moved.
+         * @return true if the item was pushed, false if the queue was shut down.
+         */
+        bool waitPush(T&& item)
+        {
+            utils::backoff::Backoff backoff{};
+            while (!m_stopped.load(std::memory_order_relaxed))
+            {
+                if (tryPush(std::move(item)))
+                {
+                    return true;
+                }
+                backoff.pause();
+            }
+            return false;
+        }
+
+        /**
+         * @brief Pushes copies of a range of items into the queue.
+         *
+         * Waits while the queue is full.
+         *
+         * @param first Iterator to the first item.
+         * @param last Iterator past the last item.
+         * @return true if all items were pushed, false if the queue was shut down first.
+         */
+        template <typename InputIt>
+        bool waitPushBatch(InputIt first, InputIt last)
+        {
+            for (; first != last; ++first)
+            {
+                if (!waitPush(*first))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Pops an item from the queue.
+         *
+         * Waits until an item is available or shutdown was triggered.
+         *
+         * @param out Reference to store the dequeued item.
+         * @return true if an item was popped, false if shutdown and the queue was empty.
+         */
+        bool waitPop(T& out)
+        {
+            utils::backoff::Backoff backoff{};
+            while (!tryPop(out))
+            {
+                // items pushed before shutdown are visible once the stop flag is observed
+                if (m_stopped.load(std::memory_order_acquire))
+                {
+                    return tryPop(out);
+                }
+                backoff.pause();
+            }
+            return true;
+        }
+
+        /**
+         * @brief Pops up to maxCount items from the queue.
+         *
+         * Waits until at least one item is available or shutdown was triggered,
+         * then takes whatever else is available without waiting.
+         *
+         * @param out Cleared and filled with the dequeued items.
+         * @param maxCount Maximum number of items to pop.
+         * @return Number of popped items, 0 if shutdown and the queue was empty.
+         */
+        std::size_t waitPopBatch(std::vector<T>& out, std::size_t maxCount)
+        {
+            out.clear();
+
+            T item{};
+            if (maxCount == 0 || !waitPop(item))
+            {
+                return 0;
+            }
+
+            out.emplace_back(std::move(item));
+            while (out.size() < maxCount && tryPop(item))
+            {
+                out.emplace_back(std::move(item));
+            }
+            return out.size();
+        }
+
+        /**
+         * @brief Tries to push the item without waiting.
+         *
+         * @param item The item to be moved, left untouched if the queue is full.
+         * @return true if the item was pushed, false if the queue is full.
+         */
+        bool tryPush(T&& item)
+        {
+            auto position{m_enqueuePosition.value.load(std::memory_order_relaxed)};
+            Cell* cell{nullptr};
+            while (true)
+            {
+                cell = &m_cells[position & m_mask];
+                const auto sequence{cell->sequence.load(std::memory_order_acquire)};
+                const auto diff{static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position)};
+                if (diff == 0)
+                {
+                    if (m_enqueuePosition.value.compare_exchange_weak(position, position + 1,
+                                                                      std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    position = m_enqueuePosition.value.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->data = std::move(item);
+            cell->sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Tries to pop an item without waiting.
+         *
+         * @param out Reference to store the dequeued item.
+         * @return true if an item was popped, false if the queue is empty.
+         */
+        bool tryPop(T& out)
+        {
+            auto position{m_dequeuePosition.value.load(std::memory_order_relaxed)};
+            Cell* cell{nullptr};
+            while (true)
+            {
+                cell = &m_cells[position & m_mask];
+                const auto sequence{cell->sequence.load(std::memory_order_acquire)};
+                const auto diff{static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1)};
+                if (diff == 0)
+                {
+                    if (m_dequeuePosition.value.compare_exchange_weak(position, position + 1,
+                                                                      std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    position = m_dequeuePosition.value.load(std::memory_order_relaxed);
+                }
+            }
+
+            out = std::move(cell->data);
+            cell->sequence.store(position + m_mask + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Signals all waiting threads to stop.
+         *
+         * After calling shutdown, waitPush() calls fail, producers waiting for room give up,
+         * waitPop() calls drain the remaining items and then return false.
+         */
+        void shutdown()
+        {
+            m_stopped.store(true, std::memory_order_release);
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept
+        {
+            return m_mask + 1;
+        }
+
+    private:
+        static std::size_t _checkedCapacity(std::size_t capacity)
+        {
+            if (capacity < 2 || (capacity & (capacity - 1)) != 0)
+            {
+                throw std::invalid_argument("Lock-free queue capacity must be a power of two");
+            }
+            return capacity;
+        }
+
+        struct Cell
+        {
+            std::atomic<std::size_t> sequence{0};
+            T data{};
+        };
+
+        struct alignas(utils::constants::CACHE_SIZE) PaddedPosition
+        {
+            std::atomic<std::size_t> value{0};
+        };
+
+        std::unique_ptr<Cell[]> m_cells;
+        const std::size_t m_mask;
+        PaddedPosition m_enqueuePosition{};
+        PaddedPosition m_dequeuePosition{};
+        alignas(utils::constants::CACHE_SIZE) std::atomic_bool m_stopped{false};
+    };
+}
+
+#endif //LOCK_FREE_QUEUE_H
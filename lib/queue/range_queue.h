@@ -0,0 +1,103 @@
+#ifndef RANGE_QUEUE_H
+#define RANGE_QUEUE_H
+
+#include <vector>
+#include <atomic>
+#include <cstddef>
+#include <algorithm>
+
+namespace tektask::queue
+{
+    /**
+     * @class RangeQueue
+     * @brief Consumer side queue over a random access source of known size.
+     *
+     * Hands out source items in index order, consumers claim the next index
+     * with a single atomic increment. Nothing is ever pushed or copied into
+     * the queue, items are read straight from the source, e.g. a memory mapped file.
+     *
+     * @tparam SourceType Random access source with value_type, size() and operator[].
+     */
+    template <typename SourceType>
+    class RangeQueue
+    {
+    public:
+        using value_type = typename SourceType::value_type;
+
+        /**
+         * @brief Constructs a queue with all source items available for popping.
+         *
+         * @param source The source to read items from, must outlive the queue.
+         */
+        explicit RangeQueue(const SourceType& source) : m_source(source), m_size(source.size())
+        {
+        }
+
+        ~RangeQueue() = default;
+        RangeQueue(const RangeQueue&) = delete;
+        RangeQueue& operator=(const RangeQueue&) = delete;
+
+        /**
+         * @brief Pops the next source item.
+         *
+         * Never blocks, all items are available from the very beginning.
+         *
+         * @param out Reference to store the item.
+         * @return true if an item was popped, false if the source is exhausted.
+         */
+        bool waitPop(value_type& out)
+        {
+            const auto index{m_next.fetch_add(1, std::memory_order_relaxed)};
+            if (index >= m_size)
+            {
+                return false;
+            }
+
+            out = m_source[index];
+            return true;
+        }
+
+        /**
+         * @brief Pops up to maxCount consecutive source items.
+         *
+         * The whole range is claimed with a single atomic increment.
+         *
+         * @param out Cleared and filled with the items.
+         * @param maxCount Maximum number of items to pop.
+         * @return Number of popped items, 0 if the source is exhausted.
+         */
+        std::size_t waitPopBatch(std::vector<value_type>& out, std::size_t maxCount)
+        {
+            out.clear();
+
+            const auto first{m_next.fetch_add(maxCount, std::memory_order_relaxed)};
+            if (first >= m_size)
+            {
+                return 0;
+            }
+
+            const auto last{std::min(m_size, first + maxCount)};
+            for (auto index{first}; index < last; ++index)
+            {
+                out.emplace_back(m_source[index]);
+            }
+            return out.size();
+        }
+
+        /**
+         * @brief No-op, the whole source is produced up front.
+         *
+         * Kept for queue contract compatibility, consumers drain the remaining items anyway.
+         */
+        void shutdown()
+        {
+        }
+
+    private:
+        const SourceType& m_source;
+        const std::size_t m_size;
+        std::atomic<std::size_t> m_next{0};
+    };
+}
+
+#endif //RANGE_QUEUE_H
@@ -0,0 +1,419 @@
+#ifndef WORK_STEALING_QUEUE_H
+#define WORK_STEALING_QUEUE_H
+
+#include "queue/chase_lev_deque.h"
+#include "stats/stats.h"
+#include "utils/backoff/backoff.h"
+#include "utils/constants/constants.h"
+
+#include <mutex>
+#include <thread>
+#include <memory>
+#include <vector>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <condition_variable>
+
+namespace tektask::queue
+{
+    /**
+     * @class WorkStealingQueue
+     * @brief Work-stealing scheduler behind the resolver queue interface.
+     *
+     * Every pushed batch becomes a task in the producer deque. Every consumer thread
+     * owns a Chase-Lev deque: it takes up to maxCount items of a task and puts the
+     * rest back at the bottom of its own deque, so an idle consumer can steal the
+     * remainder instead of waiting behind a slow batch. Consumers look for work in
+     * their own deque first, then steal the oldest producer task, then try random
+     * victims. Idle consumers spin with backoff and then park on a condition
+     * variable, producers wake them only if somebody is parked.
+     *
+     * Consumer threads register on their first pop, up to the configured slot count,
+     * a thread keeps its slot when it pops again after using another queue meanwhile.
+     *
+     * waitPush() waits while the producer deque is full, push and shutdown semantics
+     * follow the resolver queue contract described at BlockingQueue.
+     *
+     * @tparam T Type of the elements stored in the queue.
+     */
+    template <typename T>
+    class WorkStealingQueue
+    {
+    public:
+        using value_type = T;
+
+        static constexpr std::size_t DEFAULT_WORKER_SLOTS{256};
+        static constexpr std::size_t DEFAULT_CAPACITY{1024};
+
+        // each consumer keeps at most one remainder task in its deque
+        static constexpr std::size_t WORKER_DEQUE_CAPACITY{16};
+
+        /**
+         * @brief Constructs an empty queue.
+         *
+         * @param workerSlots Maximum number of consumer threads.
+         * @param capacity Producer deque capacity in tasks (pushed batches), must be a power of two.
+         *
+         * @throws if capacity isn't a power of two.
+         */
+        explicit WorkStealingQueue(std::size_t workerSlots = DEFAULT_WORKER_SLOTS,
+                                   std::size_t capacity = DEFAULT_CAPACITY) :
+            m_injector(capacity),
+            m_workers(std::make_unique<Worker[]>(workerSlots)),
+            m_workerSlots(workerSlots),
+            m_instance(_nextInstance())
+        {
+        }
+
+        ~WorkStealingQueue()
+        {
+            Task* task{nullptr};
+            while (m_injector.steal(task))
+            {
+                delete task;
+            }
+            for (std::size_t i = 0; i < m_workerSlots; ++i)
+            {
+                while (m_workers[i].deque.steal(task))
+                {
+                    delete task;
+                }
+            }
+        }
+
+        WorkStealingQueue(const WorkStealingQueue&) = delete;
+        WorkStealingQueue& operator=(const WorkStealingQueue&) = delete;
+        WorkStealingQueue(WorkStealingQueue&&) = delete;
+        WorkStealingQueue& operator=(WorkStealingQueue&&) = delete;
+
+        /**
+         * @brief Pushes a copy of the item into the queue, as a single item task.
+         *
+         * Producer side, waits while the producer deque is full.
+         *
+         * @return true if the item was pushed, false if the queue was shut down.
+         */
+        bool waitPush(const T& item)
+        {
+            return waitPushBatch(&item, &item + 1);
+        }
+
+        /**
+         * @brief Pushes copies of a range of items into the queue, as a single task.
+         *
+         * Producer side, a single producer thread is supported. Waits while the producer deque is full.
+         *
+         * @param first Iterator to the first item.
+         * @param last Iterator past the last item.
+         * @return true if the items were pushed, false if the queue was shut down.
+         */
+        template <typename InputIt>
+        bool waitPushBatch(InputIt first, InputIt last)
+        {
+            if (m_stopped.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+            if (first == last)
+            {
+                return true;
+            }
+
+            auto task{std::make_unique<Task>()};
+            task->items.assign(first, last);
+            utils::backoff::Backoff backoff{};
+            while (!m_injector.push(task.get()))
+            {
+                if (m_stopped.load(std::memory_order_relaxed))
+                {
+                    return false;
+                }
+                backoff.pause();
+            }
+            task.release();
+            _wake();
+            return true;
+        }
+
+        /**
+         * @brief Pops an item from the queue.
+         *
+         * Waits until an item is available or shutdown was triggered.
+         *
+         * @param out Reference to store the dequeued item.
+         * @return true if an item was popped, false if shutdown and the queue was empty.
+         */
+        bool waitPop(T& out)
+        {
+            std::vector<T> items{};
+            if (waitPopBatch(items, 1) == 0)
+            {
+                return false;
+            }
+            out = std::move(items.front());
+            return true;
+        }
+
+        /**
+         * @brief Pops up to maxCount items of a single task.
+         *
+         * Waits until a task is available or shutdown was triggered, the rest of
+         * the task stays in the calling thread deque, open for stealing.
+         *
+         * @param out Cleared and filled with the dequeued items.
+         * @param maxCount Maximum number of items to pop.
+         * @return Number of popped items, 0 if shutdown and the queue was empty.
+         */
+        std::size_t waitPopBatch(std::vector<T>& out, std::size_t maxCount)
+        {
+            out.clear();
+            if (maxCount == 0)
+            {
+                return 0;
+            }
+
+            auto& self{_self()};
+            utils::backoff::Backoff backoff{};
+            while (true)
+            {
+                if (auto* task{_find(self)}; task != nullptr)
+                {
+                    _take(self, task, out, maxCount);
+                    return out.size();
+                }
+
+                // items pushed before shutdown are visible once the stop flag is observed
+                if (m_stopped.load(std::memory_order_acquire))
+                {
+                    if (auto* task{_find(self)}; task != nullptr)
+                    {
+                        _take(self, task, out, maxCount);
+                        return out.size();
+                    }
+                    return 0;
+                }
+
+                if (!backoff.isYielding())
+                {
+                    backoff.pause();
+                    continue;
+                }
+                _park();
+                backoff.reset();
+            }
+        }
+
+        /**
+         * @brief Signals all waiting threads to stop.
+         *
+         * After calling shutdown, waitPush() calls fail, producers waiting for room give up,
+         * waitPop() calls drain the remaining items and then return false.
+         */
+        void shutdown()
+        {
+            m_stopped.store(true, std::memory_order_release);
+            {
+                std::lock_guard lock{m_mutex};
+                ++m_epoch;
+            }
+            m_parked.notify_all();
+        }
+
+    private:
+        struct Task
+        {
+            std::vector<T> items{};
+            std::size_t next{0};
+        };
+
+        struct alignas(utils::constants::CACHE_SIZE) Worker
+        {
+            ChaseLevDeque<Task*> deque{WORKER_DEQUE_CAPACITY};
+            uint64_t seed{0};
+            std::atomic<std::thread::id> owner{};
+        };
+
+        /**
+         * @brief Deque slot of the calling thread, registers the thread on its first call.
+         *
+         * @throws if all slots are taken.
+         */
+        Worker& _self()
+        {
+            // queue instances are told apart by a process wide id, addresses can be reused
+            struct Registration
+            {
+                uint64_t instance{0};
+                std::size_t slot{0};
+            };
+            thread_local Registration registration{};
+
+            if (registration.instance != m_instance)
+            {
+                registration = {m_instance, _register()};
+            }
+            return m_workers[registration.slot];
+        }
+
+        /**
+         * @brief Slot owned by the calling thread, a new one if it has none yet.
+         *
+         * @throws if all slots are taken.
+         */
+        std::size_t _register()
+        {
+            // the thread registration cache holds a single queue, a thread switching queues finds its slot here
+            const auto self{std::this_thread::get_id()};
+            const auto registered{std::min(m_registered.load(std::memory_order_acquire), m_workerSlots)};
+            for (std::size_t slot = 0; slot < registered; ++slot)
+            {
+                if (m_workers[slot].owner.load(std::memory_order_relaxed) == self)
+                {
+                    return slot;
+                }
+            }
+
+            const auto slot{m_registered.fetch_add(1, std::memory_order_acq_rel)};
+            if (slot >= m_workerSlots)
+            {
+                throw std::length_error("Work-stealing queue worker slots exhausted");
+            }
+            m_workers[slot].seed = 0x9E3779B97F4A7C15ull * (slot + 1);
+            m_workers[slot].owner.store(self, std::memory_order_relaxed);
+            return slot;
+        }
+
+        /**
+         * @brief Finds a task: own deque first, then the oldest producer task, then random victims.
+         */
+        Task* _find(Worker& self)
+        {
+            Task* task{nullptr};
+            if (self.deque.pop(task) || m_injector.steal(task))
+            {
+                return task;
+            }
+
+            const auto registered{std::min(m_registered.load(std::memory_order_acquire), m_workerSlots)};
+            for (std::size_t attempt = 0; attempt < registered; ++attempt)
+            {
+                auto& victim{m_workers[_random(self) % registered]};
+                if (&victim != &self && victim.deque.steal(task))
+                {
+                    stats::count(stats::Counter::Steals);
+                    return task;
+                }
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief Moves up to maxCount task items out, keeps the rest in own deque for thieves.
+         */
+        void _take(Worker& self, Task* task, std::vector<T>& out, std::size_t maxCount)
+        {
+            const auto last{std::min(task->items.size(), task->next + maxCount)};
+            out.insert(out.end(), std::make_move_iterator(task->items.begin() + static_cast<std::ptrdiff_t>(task->next)),
+                       std::make_move_iterator(task->items.begin() + static_cast<std::ptrdiff_t>(last)));
+            task->next = last;
+
+            if (task->next == task->items.size())
+            {
+                delete task;
+                return;
+            }
+
+            // a single remainder at a time, own deque is never full
+            self.deque.push(task);
+            _wake();
+        }
+
+        /**
+         * @brief Sleeps until new work is published or shutdown is triggered.
+         */
+        void _park()
+        {
+            std::unique_lock lock{m_mutex};
+            const auto epoch{m_epoch};
+            m_sleepers.fetch_add(1, std::memory_order_seq_cst);
+
+            // re-check after announcing the sleep, a publisher either sees the sleeper or we see its work
+            if (!_hasWork() && !m_stopped.load(std::memory_order_acquire))
+            {
+                stats::count(stats::Counter::EmptyQueueWaits);
+                m_parked.wait(lock, [this, epoch]
+                {
+                    return m_epoch != epoch || m_stopped.load(std::memory_order_acquire);
+                });
+            }
+            m_sleepers.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Wakes a parked consumer after work was published, if there is one.
+         */
+        void _wake()
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_sleepers.load(std::memory_order_relaxed) == 0)
+            {
+                return;
+            }
+
+            {
+                std::lock_guard lock{m_mutex};
+                ++m_epoch;
+            }
+            m_parked.notify_one();
+        }
+
+        [[nodiscard]] bool _hasWork() const noexcept
+        {
+            if (m_injector.size() != 0)
+            {
+                return true;
+            }
+
+            const auto registered{std::min(m_registered.load(std::memory_order_acquire), m_workerSlots)};
+            for (std::size_t i = 0; i < registered; ++i)
+            {
+                if (m_workers[i].deque.size() != 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        static uint64_t _random(Worker& self) noexcept
+        {
+            // xorshift64
+            self.seed ^= self.seed << 13;
+            self.seed ^= self.seed >> 7;
+            self.seed ^= self.seed << 17;
+            return self.seed;
+        }
+
+        static uint64_t _nextInstance() noexcept
+        {
+            static std::atomic<uint64_t> instances{0};
+            return instances.fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+
+        ChaseLevDeque<Task*> m_injector;
+        std::unique_ptr<Worker[]> m_workers;
+        const std::size_t m_workerSlots;
+        const uint64_t m_instance;
+        std::atomic<std::size_t> m_registered{0};
+
+        std::mutex m_mutex{};
+        std::condition_variable m_parked{};
+        uint64_t m_epoch{0};
+        alignas(utils::constants::CACHE_SIZE) std::atomic<std::size_t> m_sleepers{0};
+        std::atomic_bool m_stopped{false};
+    };
+}
+
+#endif //WORK_STEALING_QUEUE_H
@@ -0,0 +1,200 @@
+#ifndef EXACT_DISCRIMINANT_H
+#define EXACT_DISCRIMINANT_H
+
+#include "resolver/solve_kernel.h"
+#include "utils/types/types.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace tektask::resolver
+{
+    // with smaller coefficient magnitudes b*b and 4*a*c are exact doubles
+    static constexpr int64_t EXACT_DOUBLE_LIMIT{int64_t{1} << 26};
+
+    /**
+     * @brief Range bits of the coefficients, below EXACT_RANGE_BOUND only if all of them are in [-2^26, 2^26).
+     *
+     * x + 2^26 is below 2^27 only for x in range, negative x wrap around. Range bits of
+     * many triplets can be OR-ed together, the result is in range only if all of them are.
+     */
+    inline uint64_t exactRangeBits(int64_t a, int64_t b, int64_t c) noexcept
+    {
+        constexpr auto LIMIT{static_cast<uint64_t>(EXACT_DOUBLE_LIMIT)};
+        return (static_cast<uint64_t>(a) + LIMIT) | (static_cast<uint64_t>(b) + LIMIT) |
+               (static_cast<uint64_t>(c) + LIMIT);
+    }
+
+    static constexpr uint64_t EXACT_RANGE_BOUND{2 * static_cast<uint64_t>(EXACT_DOUBLE_LIMIT)};
+
+    /**
+     * @brief true if the double discriminant of the coefficients has the exact sign.
+     *
+     * b*b and 4*a*c are exact below 2^26, their correctly rounded difference keeps
+     * the sign of the exact one and is zero only if the exact one is, so solve()
+     * classifies such equations exactly. A single compare for all three coefficients.
+     */
+    inline bool fitsDoubleDiscriminant(int64_t a, int64_t b, int64_t c) noexcept
+    {
+        return exactRangeBits(a, b, c) < EXACT_RANGE_BOUND;
+    }
+
+    /**
+     * @brief true if all coefficients of the triplets are in the exact double range, a single pass without branches.
+     */
+    inline bool fitsDoubleDiscriminant(const utils::types::Triplet* items, std::size_t count) noexcept
+    {
+        uint64_t range{0};
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            range |= exactRangeBits(items[i].a, items[i].b, items[i].c);
+        }
+        return range < EXACT_RANGE_BOUND;
+    }
+
+    namespace detail
+    {
+        /**
+         * @brief Exact discriminant of int64 coefficients as D = 4 * quarter + odd.
+         *
+         * b*b - 4*a*c needs 130 bits for extreme coefficients, with |b| = 2h + odd it is
+         * 4 * (h*h + h*odd - a*c) + odd, and the bracket always fits into __int128.
+         */
+        struct Discriminant
+        {
+            __int128 quarter{0};
+            int odd{0};
+
+            [[nodiscard]] int sign() const noexcept
+            {
+                if (quarter != 0)
+                {
+                    return quarter < 0 ? -1 : 1;
+                }
+                return odd;
+            }
+        };
+
+        inline Discriminant discriminant(int64_t a, int64_t b, int64_t c) noexcept
+        {
+            const auto magnitude{b < 0 ? 0 - static_cast<uint64_t>(b) : static_cast<uint64_t>(b)};
+            const auto half{static_cast<__int128>(magnitude >> 1)};
+            const auto odd{static_cast<int>(magnitude & 1)};
+            return {half * half + half * odd - static_cast<__int128>(a) * c, odd};
+        }
+
+        /**
+         * @brief Integer square root of a positive discriminant below 2^102, or -1 if it isn't a perfect square.
+         *
+         * @param D Exact discriminant.
+         * @param sqrtD Its rounded double square root.
+         */
+        inline int64_t perfectSquareRoot(const Discriminant& D, double sqrtD) noexcept
+        {
+            // below 2^51 the rounded root is less than 0.5 off the exact one, so rounding finds it,
+            // larger integer roots aren't exact doubles anyway
+            if (!(sqrtD < 0x1p51))
+            {
+                return -1;
+            }
+
+            const auto root{std::llround(sqrtD)};
+            const auto square{static_cast<__int128>(root) * root};
+            return square == 4 * D.quarter + D.odd ? static_cast<int64_t>(root) : -1;
+        }
+    }
+
+    /**
+     * @brief Exact sign of b*b - 4*a*c for any int64 coefficients.
+     *
+     * @return -1, 0 or 1.
+     */
+    inline int discriminantSign(int64_t a, int64_t b, int64_t c) noexcept
+    {
+        return detail::discriminant(a, b, c).sign();
+    }
+
+    /**
+     * @brief Solves a quadratic equation with coefficients of any magnitude, classification is exact.
+     *
+     * The solution kind comes from the exact integer discriminant, so D == 0 and D < 0
+     * are never confused with their neighbours by rounding. Roots of a perfect square
+     * discriminant come from integer numerators, other roots from the cancellation free
+     * form: the root with |-b| + sqrt(D) numerator is computed directly, the other one
+     * as 2c over that numerator. Linear equations and the extremum are solved like solve() does.
+     *
+     * @param a Coefficient of x^2.
+     * @param b Coefficient of x.
+     * @param c Free coefficient.
+     * @return Numeric equation solution.
+     */
+    inline utils::types::EquationSolution solveWide(int64_t a, int64_t b, int64_t c) noexcept
+    {
+        using utils::types::SolveCase;
+
+        const double bd{static_cast<double>(b)};
+        if (a == 0)
+        {
+            return solve(0.0, bd, static_cast<double>(c));
+        }
+
+        // extremum and single root exactly as solve() computes them
+        const double twoA{2 * static_cast<double>(a)};
+        const double xMin{-bd / twoA};
+        const double xMinNormalized{xMin == 0.0 ? 0.0 : xMin};
+
+        const auto D{detail::discriminant(a, b, c)};
+        const auto sign{D.sign()};
+        if (sign < 0)
+        {
+            return {SolveCase::NoRealRoots, 0.0, 0.0, xMinNormalized};
+        }
+        if (sign == 0)
+        {
+            return {SolveCase::SingleRoot, xMin, 0.0, xMinNormalized};
+        }
+
+        // 4 * quarter may not fit, scaling the rounded quarter is exact
+        const double sqrtD{std::sqrt(4 * static_cast<double>(D.quarter) + D.odd)};
+        if (const auto root{detail::perfectSquareRoot(D, sqrtD)}; root >= 0)
+        {
+            const auto x1{static_cast<double>(-static_cast<__int128>(b) + root) / twoA};
+            const auto x2{static_cast<double>(-static_cast<__int128>(b) - root) / twoA};
+            return {SolveCase::TwoRoots, x1, x2, xMinNormalized};
+        }
+
+        if (b == 0)
+        {
+            return {SolveCase::TwoRoots, sqrtD / twoA, -sqrtD / twoA, xMinNormalized};
+        }
+
+        // c == 0 makes D a perfect square above 2^102, its zero root keeps the sign solve() gives it
+        const double twoC{2 * static_cast<double>(c)};
+        if (b > 0)
+        {
+            const double numerator{-bd - sqrtD};
+            return {SolveCase::TwoRoots, c == 0 ? 0.0 / twoA : twoC / numerator, numerator / twoA, xMinNormalized};
+        }
+
+        const double numerator{-bd + sqrtD};
+        return {SolveCase::TwoRoots, numerator / twoA, c == 0 ? 0.0 / twoA : twoC / numerator, xMinNormalized};
+    }
+
+    /**
+     * @brief Solves a quadratic equation with exact classification over the whole int64 range.
+     *
+     * Small coefficients take the plain double path, solve(), which is already exact for them,
+     * others go through solveWide().
+     */
+    inline utils::types::EquationSolution solveExact(int64_t a, int64_t b, int64_t c) noexcept
+    {
+        if (fitsDoubleDiscriminant(a, b, c))
+        {
+            return solve(static_cast<double>(a), static_cast<double>(b), static_cast<double>(c));
+        }
+        return solveWide(a, b, c);
+    }
+}
+
+#endif //EXACT_DISCRIMINANT_H
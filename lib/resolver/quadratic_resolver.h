@@ -1,39 +1,176 @@
 #ifndef QUADRATIC_RESOLVER_H
 #define QUADRATIC_RESOLVER_H
 
+#include "cache/solution_cache.h"
+#include "resolver/solve_kernel.h"
+#include "resolver/exact_discriminant.h"
+#include "resolver/result_formatter.h"
+#include "stats/stats.h"
+#include "storage/text_arena.h"
 #include "utils/types/types.h"
 
-#include <sstream>
-#include <cmath>
+#include <array>
+#include <string>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
 
 namespace tektask::resolver
 {
+    namespace detail
+    {
+        /**
+         * @brief Detects result storages that want to be told when a solution is stored (ReorderBuffer, etc).
+         */
+        template <typename StorageType, typename = void>
+        struct IsPublishing : std::false_type
+        {
+        };
+
+        template <typename StorageType>
+        struct IsPublishing<StorageType, std::void_t<decltype(std::declval<StorageType&>().publish(int64_t{}))>> :
+            std::true_type
+        {
+        };
+
+        /**
+         * @brief Detects result storages accumulating solutions instead of keeping them by id (SolutionSummary, etc).
+         */
+        template <typename StorageType, typename = void>
+        struct IsAggregating : std::false_type
+        {
+        };
+
+        template <typename StorageType>
+        struct IsAggregating<StorageType, std::void_t<decltype(std::declval<StorageType&>().add(
+            std::declval<const utils::types::EquationSolution&>()))>> : std::true_type
+        {
+        };
+
+        /**
+         * @brief Detects inputs handing out contiguous item ranges to be solved in place (ChunkedRange, etc).
+         */
+        template <typename QueueType, typename = void>
+        struct IsClaiming : std::false_type
+        {
+        };
+
+        template <typename QueueType>
+        struct IsClaiming<QueueType, std::void_t<decltype(std::declval<QueueType&>().claim(
+            std::declval<const typename QueueType::value_type*&>(), std::declval<std::size_t&>()))>> : std::true_type
+        {
+        };
+    }
+
+    /**
+     * @enum CoefficientRange
+     * @brief Coefficient magnitudes a resolver instantiation is built for.
+     */
+    enum class CoefficientRange : uint8_t
+    {
+        Full,   ///< any int64, blocks holding wide coefficients take the exact integer path
+        Narrow, ///< all coefficients in [-2^26, 2^26), the double kernel alone is exact, no range checks
+    };
+
+    /**
+     * @struct ResolverOptions
+     * @brief Compile-time resolver features.
+     *
+     * A job picks a single instantiation up front, so resolver inner loops carry
+     * neither branches nor dead code for features the job doesn't use.
+     *
+     * @tparam RANGE Coefficient range of the job input, Narrow is a promise of the caller.
+     * @tparam INSTRUMENTED Record resolve timings, solve case and cache counters, and queue waits.
+     */
+    template <CoefficientRange RANGE = CoefficientRange::Full, bool INSTRUMENTED = stats::STATS_COMPILED_IN>
+    struct ResolverOptions
+    {
+        static constexpr CoefficientRange COEFFICIENT_RANGE{RANGE};
+        static constexpr bool WIDE_COEFFICIENTS{RANGE == CoefficientRange::Full};
+        static constexpr bool INSTRUMENTED_RESOLVE{INSTRUMENTED && stats::STATS_COMPILED_IN};
+    };
+
     /**
      * @class QuadraticEquationResolver
      * @brief Solves quadratic equation based on Triplet coefficients.
      *
      * This class implemented as a runner in a worker thread. Continuously retrieves
-     * triplets from the input queue, solves the quadratic equation, and stores
-     * a formatted result into a shared result buffer at the index given by Triplet::id.
+     * triplets from the input queue, solves the quadratic equation and stores
+     * the result into a shared result buffer at the index given by Triplet::id.
      *
-     * @tparam QueueType The queue type used for feeding triplets (BlockingQueue, LockFreeQueue, etc).
+     * Storage element type selects the result form: EquationSolveResult keeps text
+     * formatted into the resolver own text arena, EquationSolution keeps the numeric
+     * solution only, text is produced later, at output time, if ever.
+     * Aggregating storages (SolutionSummary) take solutions without ids, nothing per equation is kept.
+     *
+     * @tparam QueueType The queue type used for feeding triplets (BlockingQueue, LockFreeQueue, ChunkedRange, etc).
+     * @tparam StorageType The random access result buffer type (std::vector, SegmentedStorage, ReorderBuffer, etc).
+     * @tparam Options Compile-time features, ResolverOptions.
      */
-    template <typename QueueType>
+    template <typename QueueType, typename StorageType = std::vector<utils::types::EquationSolveResult>,
+              typename Options = ResolverOptions<>>
     class QuadraticEquationResolver
     {
         using InputType = typename QueueType::value_type;
 
+        static constexpr bool WIDE_COEFFICIENTS{Options::WIDE_COEFFICIENTS};
+
+        static constexpr bool INSTRUMENTED{Options::INSTRUMENTED_RESOLVE};
+
+        static constexpr bool STRUCTURED_RESULTS{
+            std::is_same_v<typename StorageType::value_type, utils::types::EquationSolution>
+        };
+
+        static constexpr bool PUBLISHING_STORAGE{detail::IsPublishing<StorageType>::value};
+
+        static constexpr bool AGGREGATING_STORAGE{detail::IsAggregating<StorageType>::value};
+
+        static constexpr bool CLAIMING_INPUT{detail::IsClaiming<QueueType>::value};
+
     public:
         /**
-         * @brief Constructs a resolver with references at input queue and result buffer.
+         * @brief Constructs a resolver with references at input queue and structured result buffer.
          *
          * @param queue The shared input queue for receiving Triplets.
-         * @param resolveStorage The result buffer to write outputs into, by Triplet::id.
+         * @param resolveStorage The numeric result buffer to write outputs into, by Triplet::id.
          */
-        explicit QuadraticEquationResolver(QueueType& queue,
-                                           std::vector<utils::types::EquationSolveResult>& resolveStorage) :
+        explicit QuadraticEquationResolver(QueueType& queue, StorageType& resolveStorage) :
             m_queue(queue),
             m_resolveStorage(resolveStorage)
+        {
+            static_assert(STRUCTURED_RESULTS, "Text results require a text arena");
+        }
+
+        /**
+         * @brief Constructs a resolver with structured result buffer and an optional shared solution cache.
+         *
+         * With a cache equations are solved from their normalized coefficients, so triplets differing
+         * by sign and power of two factors share a single cached solution, bit-identical to solving
+         * them directly, printed coefficients stay the original ones.
+         *
+         * @param queue The shared input queue for receiving Triplets.
+         * @param resolveStorage The numeric result buffer to write outputs into, by Triplet::id.
+         * @param cache Solution cache shared between resolvers, nullptr disables caching.
+         */
+        explicit QuadraticEquationResolver(QueueType& queue, StorageType& resolveStorage, cache::SolutionCache* cache) :
+            m_queue(queue),
+            m_resolveStorage(resolveStorage),
+            m_cache(cache)
+        {
+            static_assert(STRUCTURED_RESULTS, "Text results require a text arena");
+        }
+
+        /**
+         * @brief Constructs a resolver with references at input queue, result buffer and text arena.
+         *
+         * @param queue The shared input queue for receiving Triplets.
+         * @param resolveStorage The result buffer to write outputs into, by Triplet::id.
+         * @param arena The text arena owned by this resolver, formatted results are kept there.
+         */
+        explicit QuadraticEquationResolver(QueueType& queue, StorageType& resolveStorage, storage::TextArena& arena) :
+            m_queue(queue),
+            m_resolveStorage(resolveStorage),
+            m_arena(&arena)
         {
         }
 
@@ -42,7 +179,9 @@ namespace tektask::resolver
         QuadraticEquationResolver& operator=(const QuadraticEquationResolver&) = delete;
 
         QuadraticEquationResolver(QuadraticEquationResolver&& other) noexcept : m_queue(other.m_queue),
-            m_resolveStorage(other.m_resolveStorage)
+            m_resolveStorage(other.m_resolveStorage),
+            m_arena(other.m_arena),
+            m_cache(other.m_cache)
         {
         }
 
@@ -54,6 +193,8 @@ namespace tektask::resolver
             }
             m_queue = other.m_queue;
             m_resolveStorage = other.m_resolveStorage;
+            m_arena = other.m_arena;
+            m_cache = other.m_cache;
             return *this;
         }
 
@@ -61,101 +202,319 @@ namespace tektask::resolver
          * @brief Solves a single quadratic equation based on Triplet.
          *
          * Produces a human-readable string with the roots and extremum location.
+         * Goes through the solution cache, if the resolver has one.
          *
          * @param t The input Triplet containing equation coefficients.
          * @return A formatted string representing the solution, extremum point or no solution.s
          */
         [[nodiscard]] std::string resolve(const utils::types::Triplet& t) const noexcept
         {
-            std::stringstream stream;
-            stream << "(" << t.a << ", " << t.b << ", " << t.c << ") => ";
+            if (m_cache == nullptr)
+            {
+                return format(t, _solve(t.a, t.b, t.c));
+            }
 
-            const auto a{static_cast<double>(t.a)};
-            const auto b{static_cast<double>(t.b)};
-            const auto c{static_cast<double>(t.c)};
+            const auto key{cache::normalize(t)};
+            utils::types::EquationSolution solution{};
+            if (!m_cache->find(key, solution))
+            {
+                solution = _solve(key.a, key.b, key.c);
+                m_cache->insert(key, solution);
+            }
+            return format(t, cache::orient(t, key, solution));
+        }
 
-            if (a == 0.0)
+        /**
+         * @brief Solves a batch of Triplets with the SIMD block kernel.
+         *
+         * Coefficients are gathered into structure-of-arrays blocks, results are
+         * bit-identical to resolve(): lanes with coefficients beyond the exact double
+         * range are solved again by solveWide(). Numeric solutions are stored as is, text is
+         * formatted into the resolver arena and resolve storage keeps its view,
+         * either way there are no per equation allocations. Publishing storages
+         * are notified about every stored solution. With a solution cache only
+         * misses reach the kernel.
+         *
+         * @param items Pointer to the first Triplet of the batch.
+         * @param count Number of Triplets in the batch.
+         */
+        void resolveBatch(const InputType* items, std::size_t count)
+        {
+            if constexpr (INSTRUMENTED)
             {
-                // case a == 0, b != 0; linear function
-                if (b != 0.0)
+                stats::ScopedTimer timer{stats::Stage::Resolve, count};
+                CaseCounts cases{};
+                _resolve(items, count, cases);
+
+                for (std::size_t kind = 0; kind < cases.size(); ++kind)
                 {
-                    const double x{-c / b};
-                    stream << "(" << x << "), no extremum";
+                    if (cases[kind] != 0)
+                    {
+                        stats::countCase(static_cast<utils::types::SolveCase>(kind), cases[kind]);
+                    }
                 }
+            }
+            else
+            {
+                CaseCounts cases{};
+                _resolve(items, count, cases);
+            }
+        }
+
+        /**
+         * @brief Formats equation solution into a human-readable string.
+         *
+         * @param t The input Triplet containing equation coefficients.
+         * @param solution Numeric solution of the equation.
+         * @return A formatted string representing the solution, extremum point or no solution.
+         */
+        [[nodiscard]] static std::string format(const utils::types::Triplet& t,
+                                                const utils::types::EquationSolution& solution) noexcept
+        {
+            std::array<char, MAX_RESULT_LENGTH> text{};
+            return {text.data(), formatResult(text.data(), t, solution)};
+        }
 
-                // case a == b == c == 0
-                else if (c == 0.0)
+        /**
+         * @brief Resolver runner loop.
+         *
+         * Continuously drains Triplets from the queue in batches, solves them with
+         * the block kernel, and stores the results into resolve storage at the
+         * positions given by Triplet::id. Claimed ranges are solved in place,
+         * without copying them into a batch.
+         *
+         * Terminates when the queue signals shutdown or the range is exhausted.
+         */
+        void operator()()
+        {
+            if constexpr (CLAIMING_INPUT)
+            {
+                const InputType* items{nullptr};
+                std::size_t count{0};
+                while (m_queue.claim(items, count))
                 {
-                    stream << "infinite roots, no extremum";
+                    resolveBatch(items, count);
                 }
+            }
+            else
+            {
+                std::vector<InputType> batch;
+                batch.reserve(SOLVE_BLOCK_SIZE);
 
-                // case a == b == 0, c != 0; constant line
-                else
+                while (m_queue.waitPopBatch(batch, SOLVE_BLOCK_SIZE) != 0)
                 {
-                    stream << "no solution, no extremum";
+                    if constexpr (INSTRUMENTED)
+                    {
+                        for (const auto& item : batch)
+                        {
+                            stats::markPopped(item.id);
+                        }
+                    }
+                    resolveBatch(batch.data(), batch.size());
                 }
-                return stream.str();
             }
+        }
 
-            const double D{b * b - 4 * a * c};
+    private :
+        using CaseCounts = std::array<uint64_t, stats::SOLVE_CASE_COUNT>;
 
-            // case with complex roots solution
-            if (D < 0.0)
+        static utils::types::EquationSolution _solve(int64_t a, int64_t b, int64_t c) noexcept
+        {
+            if constexpr (WIDE_COEFFICIENTS)
             {
-                stream << "no real roots";
+                return solveExact(a, b, c);
             }
-
-            // case single root
-            else if (D == 0.0)
+            else
             {
-                const double x = -b / (2 * a);
-                stream << "(" << x << ")";
+                return solve(static_cast<double>(a), static_cast<double>(b), static_cast<double>(c));
             }
+        }
 
-            // case with classical solution
+        void _resolve(const InputType* items, std::size_t count, CaseCounts& cases)
+        {
+            if (m_cache != nullptr)
+            {
+                _resolveCached(items, count, cases);
+            }
             else
             {
-                const double sqrtD{std::sqrt(D)};
-                const double x1{(-b + sqrtD) / (2 * a)};
-                const double x2{(-b - sqrtD) / (2 * a)};
-                stream << "(" << x1 << ", " << x2 << ")";
+                _resolveDirect(items, count, cases);
             }
+        }
 
-            // find extremum, f(x) == a * x^2 + b * x + c
-            // calculate derivative f'(x) = 2 * a * x + b
-            // set derivative to zero, f'(x) = 0
-            // find x, x = -b / 2 * a
-            const double xMin{-b / (2 * a)};
+        /**
+         * @brief Solves all items with the block kernel.
+         */
+        void _resolveDirect(const InputType* items, std::size_t count, CaseCounts& cases)
+        {
+            CoefficientBlock coefficients{};
+            SolutionBlock solutions{};
+
+            for (std::size_t offset = 0; offset < count; offset += SOLVE_BLOCK_SIZE)
+            {
+                coefficients.size = std::min(SOLVE_BLOCK_SIZE, count - offset);
+                uint64_t range{0};
+                for (std::size_t i = 0; i < coefficients.size; ++i)
+                {
+                    const auto& t{items[offset + i]};
+                    coefficients.a[i] = static_cast<double>(t.a);
+                    coefficients.b[i] = static_cast<double>(t.b);
+                    coefficients.c[i] = static_cast<double>(t.c);
+                    if constexpr (WIDE_COEFFICIENTS)
+                    {
+                        range |= exactRangeBits(t.a, t.b, t.c);
+                    }
+                }
 
-            // normalization, double can return -0.0
-            stream << ", Xmin=" << (xMin == 0.0 ? 0.0 : xMin);
-            return stream.str();
+                solveBlock(coefficients, solutions);
+                if (WIDE_COEFFICIENTS && range >= EXACT_RANGE_BOUND)
+                {
+                    _solveWide(coefficients.size, solutions, [&](std::size_t i) -> const auto&
+                    {
+                        return items[offset + i];
+                    });
+                }
+
+                for (std::size_t i = 0; i < coefficients.size; ++i)
+                {
+                    _store(items[offset + i], _solution(solutions, i), cases);
+                }
+            }
         }
 
         /**
-         * @brief Resolver runner loop.
-         *
-         * Continuously reads Triplets from the queue, solves them, and stores
-         * the result into resolve storage at the position given by Triplet::id.
+         * @brief Takes cached solutions, solves the misses from normalized coefficients and caches them.
+         */
+        void _resolveCached(const InputType* items, std::size_t count, CaseCounts& cases)
+        {
+            CoefficientBlock coefficients{};
+            SolutionBlock solutions{};
+            std::array<cache::NormalizedKey, SOLVE_BLOCK_SIZE> keys{};
+            std::array<std::size_t, SOLVE_BLOCK_SIZE> pending{};
+            std::size_t misses{0};
+
+            for (std::size_t offset = 0; offset < count;)
+            {
+                // gather misses until the block is full
+                coefficients.size = 0;
+                uint64_t range{0};
+                for (; offset < count && coefficients.size < SOLVE_BLOCK_SIZE; ++offset)
+                {
+                    const auto key{cache::normalize(items[offset])};
+                    utils::types::EquationSolution cached{};
+                    if (m_cache->find(key, cached))
+                    {
+                        _store(items[offset], cache::orient(items[offset], key, cached), cases);
+                        continue;
+                    }
+
+                    const auto miss{coefficients.size++};
+                    keys[miss] = key;
+                    pending[miss] = offset;
+                    coefficients.a[miss] = static_cast<double>(key.a);
+                    coefficients.b[miss] = static_cast<double>(key.b);
+                    coefficients.c[miss] = static_cast<double>(key.c);
+                    if constexpr (WIDE_COEFFICIENTS)
+                    {
+                        range |= exactRangeBits(key.a, key.b, key.c);
+                    }
+                }
+
+                if (coefficients.size == 0)
+                {
+                    continue;
+                }
+
+                misses += coefficients.size;
+                solveBlock(coefficients, solutions);
+                if (WIDE_COEFFICIENTS && range >= EXACT_RANGE_BOUND)
+                {
+                    _solveWide(coefficients.size, solutions, [&](std::size_t i) -> const auto&
+                    {
+                        return keys[i];
+                    });
+                }
+
+                for (std::size_t i = 0; i < coefficients.size; ++i)
+                {
+                    const auto solution{_solution(solutions, i)};
+                    m_cache->insert(keys[i], solution);
+                    _store(items[pending[i]], cache::orient(items[pending[i]], keys[i], solution), cases);
+                }
+            }
+
+            if constexpr (INSTRUMENTED)
+            {
+                stats::count(stats::Counter::CacheHits, count - misses);
+                stats::count(stats::Counter::CacheMisses, misses);
+            }
+        }
+
+        static utils::types::EquationSolution _solution(const SolutionBlock& solutions, std::size_t i) noexcept
+        {
+            return {solutions.kind[i], solutions.x1[i], solutions.x2[i], solutions.xMin[i]};
+        }
+
+        /**
+         * @brief Solves again the block lanes with coefficients beyond the exact double range.
          *
-         * Terminates when the queue signals shutdown.
+         * @param size Number of block lanes.
+         * @param solutions Kernel solutions, wide lanes are overwritten.
+         * @param coefficients Lane index to its coefficients (Triplet or NormalizedKey).
          */
-        void operator()()
+        template <typename Coefficients>
+        static void _solveWide(std::size_t size, SolutionBlock& solutions, Coefficients&& coefficients) noexcept
         {
-            while (true)
+            for (std::size_t i = 0; i < size; ++i)
             {
-                InputType item;
-                if (!m_queue.waitPop(item))
-                    break;
+                const auto& t{coefficients(i)};
+                if (fitsDoubleDiscriminant(t.a, t.b, t.c))
+                {
+                    continue;
+                }
 
-                auto result{resolve(item)};
-                m_resolveStorage[item.id].result = std::move(result);
+                const auto solution{solveWide(t.a, t.b, t.c)};
+                solutions.kind[i] = solution.kind;
+                solutions.x1[i] = solution.x1;
+                solutions.x2[i] = solution.x2;
+                solutions.xMin[i] = solution.xMin;
+            }
+        }
+
+        /**
+         * @brief Stores a solution, or its text formatted with the original coefficients, at Triplet::id,
+         * or adds it into an aggregating storage.
+         */
+        void _store(const InputType& t, const utils::types::EquationSolution& solution, CaseCounts& cases)
+        {
+            if constexpr (INSTRUMENTED)
+            {
+                ++cases[static_cast<std::size_t>(solution.kind)];
+            }
+
+            if constexpr (AGGREGATING_STORAGE)
+            {
+                m_resolveStorage.add(solution);
+            }
+            else if constexpr (STRUCTURED_RESULTS)
+            {
+                m_resolveStorage[t.id] = solution;
+                if constexpr (PUBLISHING_STORAGE)
+                {
+                    m_resolveStorage.publish(t.id);
+                }
+            }
+            else
+            {
+                char* text{m_arena->reserve(MAX_RESULT_LENGTH)};
+                m_resolveStorage[t.id].result = m_arena->commit(formatResult(text, t, solution));
             }
         }
 
-    private :
         QueueType& m_queue;
-        std::vector<utils::types::EquationSolveResult>& m_resolveStorage;
+        StorageType& m_resolveStorage;
+        storage::TextArena* m_arena{nullptr};
+        cache::SolutionCache* m_cache{nullptr};
     };
 }
 #endif //QUADRATIC_RESOLVER_H
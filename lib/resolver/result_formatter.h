@@ -0,0 +1,105 @@
+#ifndef RESULT_FORMATTER_H
+#define RESULT_FORMATTER_H
+
+#include "utils/types/types.h"
+
+#include <charconv>
+#include <cstring>
+#include <string_view>
+
+namespace tektask::resolver
+{
+    /**
+     * Upper bound of a single formatted result length:
+     * "(" + 3 int64 (20 chars each) with separators + ") => " takes 70 chars,
+     * two roots and Xmin in %.6g notation (13 chars each) with separators take 50 chars.
+     */
+    static constexpr std::size_t MAX_RESULT_LENGTH{128};
+
+    namespace detail
+    {
+        inline char* appendText(char* out, std::string_view text) noexcept
+        {
+            std::memcpy(out, text.data(), text.size());
+            return out + text.size();
+        }
+
+        inline char* appendInteger(char* out, int64_t value) noexcept
+        {
+            // int64 takes at most 20 chars, including sign
+            return std::to_chars(out, out + 20, value).ptr;
+        }
+
+        inline char* appendDouble(char* out, double value) noexcept
+        {
+            // same as default std::ostream formatting, %g with 6 significant digits,
+            // takes at most 13 chars, like "-1.23457e+308"
+            return std::to_chars(out, out + 16, value, std::chars_format::general, 6).ptr;
+        }
+    }
+
+    /**
+     * @brief Formats equation solution into a human-readable text, without allocations.
+     *
+     * Produces exactly the same text as std::ostream based formatting,
+     * like "(1, -2, -3) => (3, -1), Xmin=1".
+     *
+     * @param out Destination buffer, at least MAX_RESULT_LENGTH bytes.
+     * @param t The input Triplet containing equation coefficients.
+     * @param solution Numeric solution of the equation.
+     * @return Number of written bytes.
+     */
+    inline std::size_t formatResult(char* out, const utils::types::Triplet& t,
+                                    const utils::types::EquationSolution& solution) noexcept
+    {
+        using namespace detail;
+        using utils::types::SolveCase;
+
+        char* cursor{out};
+        cursor = appendText(cursor, "(");
+        cursor = appendInteger(cursor, t.a);
+        cursor = appendText(cursor, ", ");
+        cursor = appendInteger(cursor, t.b);
+        cursor = appendText(cursor, ", ");
+        cursor = appendInteger(cursor, t.c);
+        cursor = appendText(cursor, ") => ");
+
+        switch (solution.kind)
+        {
+        case SolveCase::InfiniteRoots:
+            return appendText(cursor, "infinite roots, no extremum") - out;
+
+        case SolveCase::NoSolution:
+            return appendText(cursor, "no solution, no extremum") - out;
+
+        case SolveCase::Linear:
+            cursor = appendText(cursor, "(");
+            cursor = appendDouble(cursor, solution.x1);
+            return appendText(cursor, "), no extremum") - out;
+
+        case SolveCase::NoRealRoots:
+            cursor = appendText(cursor, "no real roots");
+            break;
+
+        case SolveCase::SingleRoot:
+            cursor = appendText(cursor, "(");
+            cursor = appendDouble(cursor, solution.x1);
+            cursor = appendText(cursor, ")");
+            break;
+
+        case SolveCase::TwoRoots:
+            cursor = appendText(cursor, "(");
+            cursor = appendDouble(cursor, solution.x1);
+            cursor = appendText(cursor, ", ");
+            cursor = appendDouble(cursor, solution.x2);
+            cursor = appendText(cursor, ")");
+            break;
+        }
+
+        cursor = appendText(cursor, ", Xmin=");
+        cursor = appendDouble(cursor, solution.xMin);
+        return cursor - out;
+    }
+}
+
+#endif //RESULT_FORMATTER_H
@@ -0,0 +1,243 @@
+#include "solve_kernel.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define TEKTASK_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+
+namespace tektask::resolver
+{
+    using namespace tektask::utils::types;
+
+    namespace
+    {
+        using KernelFn = void (*)(const CoefficientBlock&, SolutionBlock&) noexcept;
+
+        /**
+         * @brief Solves lanes [first, coefficients.size) one by one.
+         */
+        void solveTail(const CoefficientBlock& coefficients, SolutionBlock& solutions, std::size_t first) noexcept
+        {
+            for (auto i{first}; i < coefficients.size; ++i)
+            {
+                const auto solution{solve(coefficients.a[i], coefficients.b[i], coefficients.c[i])};
+                solutions.kind[i] = solution.kind;
+                solutions.x1[i] = solution.x1;
+                solutions.x2[i] = solution.x2;
+                solutions.xMin[i] = solution.xMin;
+            }
+        }
+
+        void solveScalar(const CoefficientBlock& coefficients, SolutionBlock& solutions) noexcept
+        {
+            solveTail(coefficients, solutions, 0);
+        }
+
+        /**
+         * @brief Picks the solution kind of a single lane from comparison mask bits.
+         */
+        SolveCase laneKind(int aZero, int bZero, int cZero, int dNegative, int dZero) noexcept
+        {
+            if (aZero)
+            {
+                if (!bZero)
+                {
+                    return SolveCase::Linear;
+                }
+                return cZero ? SolveCase::InfiniteRoots : SolveCase::NoSolution;
+            }
+
+            if (dNegative)
+            {
+                return SolveCase::NoRealRoots;
+            }
+            return dZero ? SolveCase::SingleRoot : SolveCase::TwoRoots;
+        }
+
+#if defined(TEKTASK_X86_KERNELS)
+        /**
+         * @brief SSE2 kernel, 2 lanes per iteration.
+         *
+         * Every lane computes all cases, the results are selected by a==0, D<0 and D==0 masks.
+         */
+        void solveSse2(const CoefficientBlock& coefficients, SolutionBlock& solutions) noexcept
+        {
+            static constexpr std::size_t LANES{2};
+
+            const __m128d zero{_mm_setzero_pd()};
+            const __m128d two{_mm_set1_pd(2.0)};
+            const __m128d four{_mm_set1_pd(4.0)};
+            const __m128d sign{_mm_set1_pd(-0.0)};
+
+            auto select = [](__m128d mask, __m128d ifTrue, __m128d ifFalse)
+            {
+                return _mm_or_pd(_mm_and_pd(mask, ifTrue), _mm_andnot_pd(mask, ifFalse));
+            };
+
+            std::size_t i{0};
+            for (; i + LANES <= coefficients.size; i += LANES)
+            {
+                const __m128d a{_mm_load_pd(coefficients.a.data() + i)};
+                const __m128d b{_mm_load_pd(coefficients.b.data() + i)};
+                const __m128d c{_mm_load_pd(coefficients.c.data() + i)};
+
+                const __m128d negB{_mm_xor_pd(b, sign)};
+                const __m128d twoA{_mm_mul_pd(two, a)};
+                const __m128d D{_mm_sub_pd(_mm_mul_pd(b, b), _mm_mul_pd(_mm_mul_pd(four, a), c))};
+                const __m128d sqrtD{_mm_sqrt_pd(D)};
+
+                const __m128d linear{_mm_div_pd(_mm_xor_pd(c, sign), b)};
+                const __m128d xMin{_mm_div_pd(negB, twoA)};
+                const __m128d x1{_mm_div_pd(_mm_add_pd(negB, sqrtD), twoA)};
+                const __m128d x2{_mm_div_pd(_mm_sub_pd(negB, sqrtD), twoA)};
+
+                const __m128d aZero{_mm_cmpeq_pd(a, zero)};
+                const __m128d bZero{_mm_cmpeq_pd(b, zero)};
+                const __m128d cZero{_mm_cmpeq_pd(c, zero)};
+                const __m128d dNegative{_mm_cmplt_pd(D, zero)};
+                const __m128d dZero{_mm_cmpeq_pd(D, zero)};
+
+                const __m128d quadratic{_mm_andnot_pd(aZero, _mm_cmpeq_pd(zero, zero))};
+                const __m128d twoRoots{_mm_andnot_pd(_mm_or_pd(dNegative, dZero), quadratic)};
+
+                // x1: linear root, single root (== raw xMin) or the first of two roots
+                __m128d root1{select(twoRoots, x1, _mm_and_pd(dZero, xMin))};
+                root1 = select(aZero, _mm_andnot_pd(bZero, linear), _mm_and_pd(quadratic, root1));
+
+                _mm_store_pd(solutions.x1.data() + i, root1);
+                _mm_store_pd(solutions.x2.data() + i, _mm_and_pd(twoRoots, x2));
+                _mm_store_pd(solutions.xMin.data() + i, _mm_and_pd(quadratic, _mm_andnot_pd(_mm_cmpeq_pd(xMin, zero), xMin)));
+
+                const int aBits{_mm_movemask_pd(aZero)};
+                const int bBits{_mm_movemask_pd(bZero)};
+                const int cBits{_mm_movemask_pd(cZero)};
+                const int negativeBits{_mm_movemask_pd(dNegative)};
+                const int zeroBits{_mm_movemask_pd(dZero)};
+                for (std::size_t lane = 0; lane < LANES; ++lane)
+                {
+                    solutions.kind[i + lane] = laneKind(aBits >> lane & 1, bBits >> lane & 1, cBits >> lane & 1,
+                                                        negativeBits >> lane & 1, zeroBits >> lane & 1);
+                }
+            }
+
+            solveTail(coefficients, solutions, i);
+        }
+
+        /**
+         * @brief AVX2 kernel, 4 lanes per iteration.
+         *
+         * Every lane computes all cases, the results are selected by a==0, D<0 and D==0 masks.
+         * FMA is deliberately not used, contraction would break bit equality with the scalar path.
+         */
+        __attribute__((target("avx2")))
+        void solveAvx2(const CoefficientBlock& coefficients, SolutionBlock& solutions) noexcept
+        {
+            static constexpr std::size_t LANES{4};
+
+            const __m256d zero{_mm256_setzero_pd()};
+            const __m256d two{_mm256_set1_pd(2.0)};
+            const __m256d four{_mm256_set1_pd(4.0)};
+            const __m256d sign{_mm256_set1_pd(-0.0)};
+
+            std::size_t i{0};
+            for (; i + LANES <= coefficients.size; i += LANES)
+            {
+                const __m256d a{_mm256_load_pd(coefficients.a.data() + i)};
+                const __m256d b{_mm256_load_pd(coefficients.b.data() + i)};
+                const __m256d c{_mm256_load_pd(coefficients.c.data() + i)};
+
+                const __m256d negB{_mm256_xor_pd(b, sign)};
+                const __m256d twoA{_mm256_mul_pd(two, a)};
+                const __m256d D{_mm256_sub_pd(_mm256_mul_pd(b, b), _mm256_mul_pd(_mm256_mul_pd(four, a), c))};
+                const __m256d sqrtD{_mm256_sqrt_pd(D)};
+
+                const __m256d linear{_mm256_div_pd(_mm256_xor_pd(c, sign), b)};
+                const __m256d xMin{_mm256_div_pd(negB, twoA)};
+                const __m256d x1{_mm256_div_pd(_mm256_add_pd(negB, sqrtD), twoA)};
+                const __m256d x2{_mm256_div_pd(_mm256_sub_pd(negB, sqrtD), twoA)};
+
+                const __m256d aZero{_mm256_cmp_pd(a, zero, _CMP_EQ_OQ)};
+                const __m256d bZero{_mm256_cmp_pd(b, zero, _CMP_EQ_OQ)};
+                const __m256d cZero{_mm256_cmp_pd(c, zero, _CMP_EQ_OQ)};
+                const __m256d dNegative{_mm256_cmp_pd(D, zero, _CMP_LT_OQ)};
+                const __m256d dZero{_mm256_cmp_pd(D, zero, _CMP_EQ_OQ)};
+
+                const __m256d quadratic{_mm256_andnot_pd(aZero, _mm256_cmp_pd(zero, zero, _CMP_EQ_OQ))};
+                const __m256d twoRoots{_mm256_andnot_pd(_mm256_or_pd(dNegative, dZero), quadratic)};
+
+                // x1: linear root, single root (== raw xMin) or the first of two roots
+                __m256d root1{_mm256_blendv_pd(_mm256_and_pd(dZero, xMin), x1, twoRoots)};
+                root1 = _mm256_blendv_pd(_mm256_and_pd(quadratic, root1), _mm256_andnot_pd(bZero, linear), aZero);
+
+                const __m256d xMinNormalized{_mm256_andnot_pd(_mm256_cmp_pd(xMin, zero, _CMP_EQ_OQ), xMin)};
+
+                _mm256_store_pd(solutions.x1.data() + i, root1);
+                _mm256_store_pd(solutions.x2.data() + i, _mm256_and_pd(twoRoots, x2));
+                _mm256_store_pd(solutions.xMin.data() + i, _mm256_and_pd(quadratic, xMinNormalized));
+
+                const int aBits{_mm256_movemask_pd(aZero)};
+                const int bBits{_mm256_movemask_pd(bZero)};
+                const int cBits{_mm256_movemask_pd(cZero)};
+                const int negativeBits{_mm256_movemask_pd(dNegative)};
+                const int zeroBits{_mm256_movemask_pd(dZero)};
+                for (std::size_t lane = 0; lane < LANES; ++lane)
+                {
+                    solutions.kind[i + lane] = laneKind(aBits >> lane & 1, bBits >> lane & 1, cBits >> lane & 1,
+                                                        negativeBits >> lane & 1, zeroBits >> lane & 1);
+                }
+            }
+
+            solveTail(coefficients, solutions, i);
+        }
+#endif
+
+        KernelFn selectKernel(SolveKernelIsa isa) noexcept
+        {
+#if defined(TEKTASK_X86_KERNELS)
+            // requested kernel is never wider than the CPU supports
+            const auto supported{detectSolveKernelIsa()};
+            isa = static_cast<uint8_t>(isa) > static_cast<uint8_t>(supported) ? supported : isa;
+
+            switch (isa)
+            {
+            case SolveKernelIsa::Avx2:
+                return solveAvx2;
+            case SolveKernelIsa::Sse2:
+                return solveSse2;
+            default:
+                break;
+            }
+#endif
+            (void)isa;
+            return solveScalar;
+        }
+    }
+
+    SolveKernelIsa detectSolveKernelIsa() noexcept
+    {
+#if defined(TEKTASK_X86_KERNELS)
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return SolveKernelIsa::Avx2;
+        }
+        if (__builtin_cpu_supports("sse2"))
+        {
+            return SolveKernelIsa::Sse2;
+        }
+#endif
+        return SolveKernelIsa::Scalar;
+    }
+
+    void solveBlock(const CoefficientBlock& coefficients, SolutionBlock& solutions) noexcept
+    {
+        // dispatch once, CPU features don't change at runtime
+        static const KernelFn kernel{selectKernel(detectSolveKernelIsa())};
+        kernel(coefficients, solutions);
+    }
+
+    void solveBlock(const CoefficientBlock& coefficients, SolutionBlock& solutions, SolveKernelIsa isa) noexcept
+    {
+        selectKernel(isa)(coefficients, solutions);
+    }
+}
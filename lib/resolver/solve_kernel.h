@@ -0,0 +1,130 @@
+#ifndef SOLVE_KERNEL_H
+#define SOLVE_KERNEL_H
+
+#include "utils/types/types.h"
+
+#include <array>
+#include <cmath>
+
+namespace tektask::resolver
+{
+    static constexpr std::size_t SOLVE_BLOCK_SIZE{256};
+
+    /**
+     * @struct CoefficientBlock
+     * @brief Structure-of-arrays block of equation coefficients for batch solving.
+     */
+    struct CoefficientBlock
+    {
+        alignas(32) std::array<double, SOLVE_BLOCK_SIZE> a{};
+        alignas(32) std::array<double, SOLVE_BLOCK_SIZE> b{};
+        alignas(32) std::array<double, SOLVE_BLOCK_SIZE> c{};
+        std::size_t size{0};
+    };
+
+    /**
+     * @struct SolutionBlock
+     * @brief Structure-of-arrays block of solutions, lane i corresponds to CoefficientBlock lane i.
+     */
+    struct SolutionBlock
+    {
+        alignas(32) std::array<double, SOLVE_BLOCK_SIZE> x1{};
+        alignas(32) std::array<double, SOLVE_BLOCK_SIZE> x2{};
+        alignas(32) std::array<double, SOLVE_BLOCK_SIZE> xMin{};
+        std::array<utils::types::SolveCase, SOLVE_BLOCK_SIZE> kind{};
+    };
+
+    /**
+     * @enum SolveKernelIsa
+     * @brief Instruction set used by the batch kernel.
+     */
+    enum class SolveKernelIsa : uint8_t
+    {
+        Scalar,
+        Sse2,
+        Avx2,
+    };
+
+    /**
+     * @brief Solves a single quadratic equation, scalar reference path.
+     *
+     * Batch kernels perform exactly the same IEEE operations in the same order,
+     * so their results are bit-identical to this function.
+     *
+     * @param a Coefficient of x^2.
+     * @param b Coefficient of x.
+     * @param c Free coefficient.
+     * @return Numeric equation solution.
+     */
+    inline utils::types::EquationSolution solve(double a, double b, double c) noexcept
+    {
+        using utils::types::SolveCase;
+
+        if (a == 0.0)
+        {
+            // case a == 0, b != 0; linear function
+            if (b != 0.0)
+            {
+                return {SolveCase::Linear, -c / b};
+            }
+
+            // case a == b == c == 0, or a == b == 0, c != 0; constant line
+            return {c == 0.0 ? SolveCase::InfiniteRoots : SolveCase::NoSolution};
+        }
+
+        // find extremum, f(x) == a * x^2 + b * x + c
+        // calculate derivative f'(x) = 2 * a * x + b
+        // set derivative to zero, f'(x) = 0
+        // find x, x = -b / 2 * a
+        const double xMin{-b / (2 * a)};
+
+        // normalization, double can return -0.0
+        const double xMinNormalized{xMin == 0.0 ? 0.0 : xMin};
+
+        const double D{b * b - 4 * a * c};
+
+        // case with complex roots solution
+        if (D < 0.0)
+        {
+            return {SolveCase::NoRealRoots, 0.0, 0.0, xMinNormalized};
+        }
+
+        // case single root
+        if (D == 0.0)
+        {
+            return {SolveCase::SingleRoot, xMin, 0.0, xMinNormalized};
+        }
+
+        // case with classical solution
+        const double sqrtD{std::sqrt(D)};
+        const double x1{(-b + sqrtD) / (2 * a)};
+        const double x2{(-b - sqrtD) / (2 * a)};
+        return {SolveCase::TwoRoots, x1, x2, xMinNormalized};
+    }
+
+    /**
+     * @brief Detects the best batch kernel instruction set supported by the CPU.
+     */
+    [[nodiscard]] SolveKernelIsa detectSolveKernelIsa() noexcept;
+
+    /**
+     * @brief Solves a block of equations with the best kernel available at runtime.
+     *
+     * @param coefficients Input block, only the first coefficients.size lanes are solved.
+     * @param solutions Output block.
+     */
+    void solveBlock(const CoefficientBlock& coefficients, SolutionBlock& solutions) noexcept;
+
+    /**
+     * @brief Solves a block of equations with the requested kernel.
+     *
+     * Falls back to the scalar kernel if the instruction set isn't supported.
+     *
+     * @param coefficients Input block, only the first coefficients.size lanes are solved.
+     * @param solutions Output block.
+     * @param isa Kernel instruction set.
+     */
+    void solveBlock(const CoefficientBlock& coefficients, SolutionBlock& solutions, SolveKernelIsa isa) noexcept;
+}
+
+#endif //SOLVE_KERNEL_H
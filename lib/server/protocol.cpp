@@ -0,0 +1,108 @@
+#include "protocol.h"
+#include "io/endian.h"
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+
+#include <unistd.h>
+#include <sys/socket.h>
+
+
+namespace tektask::server
+{
+    namespace
+    {
+        [[noreturn]] void socketError(const char* what)
+        {
+            throw std::system_error(errno, std::generic_category(), what);
+        }
+
+        void writeAll(int fd, const char* data, std::size_t size)
+        {
+            while (size > 0)
+            {
+                const auto written{::send(fd, data, size, MSG_NOSIGNAL)};
+                if (written < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+                    socketError("Socket write failed");
+                }
+                data += written;
+                size -= static_cast<std::size_t>(written);
+            }
+        }
+
+        /**
+         * @brief Reads exactly size bytes.
+         *
+         * @return Number of bytes read, less than size only if the peer closed the connection.
+         */
+        std::size_t readAll(int fd, char* data, std::size_t size)
+        {
+            std::size_t done{0};
+            while (done < size)
+            {
+                const auto received{::read(fd, data + done, size - done)};
+                if (received < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+                    socketError("Socket read failed");
+                }
+                if (received == 0)
+                {
+                    break;
+                }
+                done += static_cast<std::size_t>(received);
+            }
+            return done;
+        }
+    }
+
+    void writeFrame(int fd, uint8_t kind, std::string_view payload)
+    {
+        std::array<std::byte, FRAME_HEADER_SIZE> header{};
+        std::memcpy(header.data(), FRAME_MAGIC.data(), FRAME_MAGIC.size());
+        header[4] = static_cast<std::byte>(kind);
+        io::storeLittleEndian<uint64_t>(payload.size(), header.data() + 8);
+
+        writeAll(fd, reinterpret_cast<const char*>(header.data()), header.size());
+        writeAll(fd, payload.data(), payload.size());
+    }
+
+    bool readFrame(int fd, Frame& frame)
+    {
+        std::array<std::byte, FRAME_HEADER_SIZE> header{};
+        const auto received{readAll(fd, reinterpret_cast<char*>(header.data()), header.size())};
+        if (received == 0)
+        {
+            return false;
+        }
+        if (received != header.size() || std::memcmp(header.data(), FRAME_MAGIC.data(), FRAME_MAGIC.size()) != 0)
+        {
+            throw std::runtime_error("Invalid frame header");
+        }
+
+        const auto size{io::loadLittleEndian<uint64_t>(header.data() + 8)};
+        if (size > MAX_PAYLOAD_SIZE)
+        {
+            throw std::runtime_error("Frame payload is too large");
+        }
+
+        frame.kind = static_cast<uint8_t>(header[4]);
+        frame.payload.resize(size);
+        if (readAll(fd, frame.payload.data(), size) != size)
+        {
+            throw std::runtime_error("Truncated frame payload");
+        }
+        return true;
+    }
+}
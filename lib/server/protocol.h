@@ -0,0 +1,69 @@
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+#include <string>
+#include <cstdint>
+#include <string_view>
+
+
+namespace tektask::server
+{
+    /**
+     * Solver socket protocol, every message is a frame, all values are little-endian.
+     *
+     * frame header (16 bytes):
+     *   [0, 4)   magic "TEKS"
+     *   [4, 5)   uint8 kind, payload format of requests or status of responses
+     *   [5, 8)   reserved, zero
+     *   [8, 16)  uint64 payload size in bytes
+     *
+     * Text request payload holds whitespace separated coefficients, binary request
+     * payload holds 24 byte records: int64 a, int64 b, int64 c. Response payload is
+     * the text se_solver prints for the same input, or an error message.
+     * A connection carries any number of request/response pairs.
+     */
+    static constexpr std::string_view FRAME_MAGIC{"TEKS"};
+    static constexpr std::size_t FRAME_HEADER_SIZE{16};
+
+    // larger payloads are rejected before anything is allocated
+    static constexpr uint64_t MAX_PAYLOAD_SIZE{1ULL << 30};
+
+    enum class PayloadFormat : uint8_t
+    {
+        Text = 0,
+        Binary = 1,
+    };
+
+    enum class ResponseStatus : uint8_t
+    {
+        Ok = 0,
+        Error = 1,
+    };
+
+    /**
+     * @brief Single protocol message, request or response.
+     */
+    struct Frame
+    {
+        uint8_t kind{0};
+        std::string payload{};
+    };
+
+    /**
+     * @brief Writes the whole frame into the socket.
+     *
+     * @throws if the socket fails.
+     */
+    void writeFrame(int fd, uint8_t kind, std::string_view payload);
+
+    /**
+     * @brief Reads the next frame from the socket.
+     *
+     * @return false if the peer closed the connection before a new frame.
+     *
+     * @throws if the socket fails, the frame is truncated or malformed.
+     */
+    bool readFrame(int fd, Frame& frame);
+}
+
+#endif //PROTOCOL_H
@@ -0,0 +1,167 @@
+#ifndef REQUEST_TABLE_H
+#define REQUEST_TABLE_H
+
+#include "utils/types/types.h"
+
+#include <mutex>
+#include <array>
+#include <atomic>
+#include <vector>
+#include <condition_variable>
+
+
+namespace tektask::server
+{
+    /**
+     * @class PendingRequest
+     * @brief Solutions of a single client request, filled by resolvers in any order.
+     */
+    class PendingRequest
+    {
+    public:
+        /**
+         * @brief Prepares storage for the given number of solutions.
+         */
+        explicit PendingRequest(std::size_t size) :
+            m_solutions(size),
+            m_remaining(size),
+            m_finished(size == 0)
+        {
+        }
+
+        ~PendingRequest() = default;
+        PendingRequest(const PendingRequest&) = delete;
+        PendingRequest(PendingRequest&&) = delete;
+        PendingRequest& operator=(const PendingRequest&) = delete;
+        PendingRequest& operator=(PendingRequest&&) = delete;
+
+        [[nodiscard]] const std::vector<utils::types::EquationSolution>& solutions() const noexcept
+        {
+            return m_solutions;
+        }
+
+        /**
+         * @brief Blocks until every solution is published.
+         */
+        void wait()
+        {
+            std::unique_lock lock{m_mutex};
+            m_done.wait(lock, [this] { return m_finished; });
+        }
+
+    private:
+        friend class RequestTable;
+
+        std::vector<utils::types::EquationSolution> m_solutions;
+        std::atomic<std::size_t> m_remaining;
+        std::mutex m_mutex{};
+        std::condition_variable m_done{};
+        // set under the mutex, so the request outlives the last publish()
+        bool m_finished{false};
+    };
+
+    /**
+     * @class RequestTable
+     * @brief Result storage shared by resolvers, routes solutions of many concurrent requests.
+     *
+     * Triplet::id carries the request slot in the high bits and the index inside
+     * the request in the low bits, so triplets of different clients go through a
+     * single resolver queue and are batched together.
+     */
+    class RequestTable
+    {
+    public:
+        using value_type = utils::types::EquationSolution;
+
+        static constexpr int INDEX_BITS{40};
+        static constexpr int64_t INDEX_MASK{(int64_t{1} << INDEX_BITS) - 1};
+        static constexpr std::size_t SLOT_COUNT{1024};
+
+        RequestTable()
+        {
+            m_slots.fill(nullptr);
+        }
+
+        ~RequestTable() = default;
+        RequestTable(const RequestTable&) = delete;
+        RequestTable(RequestTable&&) = delete;
+        RequestTable& operator=(const RequestTable&) = delete;
+        RequestTable& operator=(RequestTable&&) = delete;
+
+        /**
+         * @brief Registers a request, waits while all slots are taken.
+         *
+         * @return Slot of the request, ids of its triplets are made with makeId().
+         */
+        uint32_t acquire(PendingRequest& request)
+        {
+            std::unique_lock lock{m_mutex};
+            m_released.wait(lock, [this] { return !m_free.empty() || m_next < SLOT_COUNT; });
+
+            uint32_t slot{0};
+            if (!m_free.empty())
+            {
+                slot = m_free.back();
+                m_free.pop_back();
+            }
+            else
+            {
+                slot = m_next++;
+            }
+            m_slots[slot] = &request;
+            return slot;
+        }
+
+        /**
+         * @brief Frees the slot of a completed request.
+         */
+        void release(uint32_t slot)
+        {
+            {
+                std::lock_guard lock{m_mutex};
+                m_slots[slot] = nullptr;
+                m_free.push_back(slot);
+            }
+            m_released.notify_one();
+        }
+
+        [[nodiscard]] static int64_t makeId(uint32_t slot, std::size_t index) noexcept
+        {
+            return (static_cast<int64_t>(slot) << INDEX_BITS) | static_cast<int64_t>(index);
+        }
+
+        /**
+         * @brief Solution slot of the triplet with the given id.
+         *
+         * The request has to be acquired before its triplets are queued, the queue
+         * makes the slot visible to resolvers.
+         */
+        utils::types::EquationSolution& operator[](int64_t id) noexcept
+        {
+            return m_slots[id >> INDEX_BITS]->m_solutions[id & INDEX_MASK];
+        }
+
+        /**
+         * @brief Marks the solution as stored, wakes the request owner after the last one.
+         */
+        void publish(int64_t id)
+        {
+            auto& request{*m_slots[id >> INDEX_BITS]};
+            if (request.m_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                std::lock_guard lock{request.m_mutex};
+                request.m_finished = true;
+                request.m_done.notify_all();
+            }
+        }
+
+    private:
+        std::mutex m_mutex{};
+        std::condition_variable m_released{};
+        std::array<PendingRequest*, SLOT_COUNT> m_slots{};
+        std::vector<uint32_t> m_free{};
+        uint32_t m_next{0};
+    };
+}
+
+#endif //REQUEST_TABLE_H
@@ -0,0 +1,285 @@
+#include "solver_server.h"
+#include "cli/stream_parser.h"
+#include "io/binary_triplets.h"
+#include "output/parallel_formatter.h"
+#include "resolver/quadratic_resolver.h"
+
+#include <cerrno>
+#include <istream>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <system_error>
+#include <streambuf>
+
+#include <unistd.h>
+#include <sys/un.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+
+
+namespace tektask::server
+{
+    using namespace tektask::utils::types;
+
+    namespace
+    {
+        constexpr std::string_view NO_VALID_PARAMETERS_MESSAGE{"Invalid input: no valid parameters"};
+
+        constexpr int LISTEN_BACKLOG{64};
+
+        /**
+         * @brief Read-only stream buffer over request payload, avoids copying it into a string stream.
+         */
+        class PayloadBuffer : public std::streambuf
+        {
+        public:
+            explicit PayloadBuffer(const std::string& payload)
+            {
+                char* begin{const_cast<char*>(payload.data())};
+                setg(begin, begin, begin + payload.size());
+            }
+        };
+    }
+
+    SolverServer::SolverServer(thread::ThreadPool& pool, cache::SolutionCache* cache) :
+        m_pool(pool)
+    {
+        using Resolver = resolver::QuadraticEquationResolver<queue::BlockingQueue<Triplet>, RequestTable>;
+
+        m_pool.start([this, cache](uint32_t)
+        {
+            Resolver resolver{m_queue, m_table, cache};
+            resolver();
+        });
+    }
+
+    SolverServer::~SolverServer()
+    {
+        stop();
+        m_queue.shutdown();
+        m_pool.wait();
+    }
+
+    Frame SolverServer::solve(const Frame& request)
+    {
+        std::string diagnostics{};
+        std::vector<Triplet> triplets{};
+        try
+        {
+            triplets = _parse(request, diagnostics);
+        }
+        catch (const std::invalid_argument& e)
+        {
+            return {static_cast<uint8_t>(ResponseStatus::Error), diagnostics + e.what()};
+        }
+
+        if (triplets.empty())
+        {
+            return {static_cast<uint8_t>(ResponseStatus::Error), diagnostics + std::string{NO_VALID_PARAMETERS_MESSAGE}};
+        }
+
+        // route solutions of this request through its table slot
+        PendingRequest pending{triplets.size()};
+        const auto slot{m_table.acquire(pending)};
+        for (auto& triplet : triplets)
+        {
+            triplet.id = RequestTable::makeId(slot, static_cast<std::size_t>(triplet.id));
+        }
+        for (std::size_t i = 0; i < triplets.size(); i += PUSH_BATCH_SIZE)
+        {
+            const auto last{std::min(triplets.size(), i + PUSH_BATCH_SIZE)};
+            m_queue.waitPushBatch(triplets.begin() + i, triplets.begin() + last);
+        }
+        pending.wait();
+        m_table.release(slot);
+
+        Frame response{static_cast<uint8_t>(ResponseStatus::Ok), std::move(diagnostics)};
+        response.payload.push_back('\n');
+        output::formatRange(triplets, pending.solutions(), 0, triplets.size(), response.payload);
+        return response;
+    }
+
+    void SolverServer::serve(const std::string& socketPath)
+    {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (socketPath.empty() || socketPath.size() >= sizeof(address.sun_path))
+        {
+            throw std::invalid_argument("Invalid input: invalid socket path " + socketPath);
+        }
+        socketPath.copy(address.sun_path, socketPath.size());
+
+        // a stale socket of a previous daemon is replaced, anything else at the path is kept
+        struct stat info{};
+        const bool exists{::lstat(socketPath.c_str(), &info) == 0};
+        if (exists && !S_ISSOCK(info.st_mode))
+        {
+            throw std::invalid_argument("Invalid input: socket path " + socketPath + " exists and isn't a socket");
+        }
+
+        const int fd{::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0)};
+        if (fd < 0)
+        {
+            throw std::system_error(errno, std::generic_category(), "Failed to create socket");
+        }
+
+        if (exists)
+        {
+            ::unlink(socketPath.c_str());
+        }
+        if (::bind(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+            ::listen(fd, LISTEN_BACKLOG) != 0)
+        {
+            const auto error{errno};
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "Failed to listen on " + socketPath);
+        }
+
+        {
+            std::lock_guard lock{m_mutex};
+            m_listenFd = fd;
+        }
+
+        while (!m_stopping.load())
+        {
+            const int client{::accept4(fd, nullptr, nullptr, SOCK_CLOEXEC)};
+            if (client < 0)
+            {
+                if (errno == EINTR || errno == ECONNABORTED)
+                {
+                    continue;
+                }
+                break;
+            }
+
+            _reapConnections(false);
+
+            std::lock_guard lock{m_mutex};
+            if (m_stopping.load())
+            {
+                ::close(client);
+                break;
+            }
+            auto& connection{m_connections.emplace_back()};
+            connection.fd = client;
+            connection.thread = std::thread{&SolverServer::_serveConnection, this, std::ref(connection)};
+        }
+
+        // closes remaining clients, also if accept failed
+        stop();
+        {
+            std::lock_guard lock{m_mutex};
+            m_listenFd = -1;
+        }
+        _reapConnections(true);
+
+        ::close(fd);
+        ::unlink(socketPath.c_str());
+    }
+
+    void SolverServer::stop()
+    {
+        std::lock_guard lock{m_mutex};
+        m_stopping.store(true);
+
+        // wakes blocked accept() and read() calls, descriptors are closed by their owners
+        if (m_listenFd >= 0)
+        {
+            ::shutdown(m_listenFd, SHUT_RDWR);
+        }
+        for (const auto& connection : m_connections)
+        {
+            if (!connection.finished)
+            {
+                ::shutdown(connection.fd, SHUT_RDWR);
+            }
+        }
+    }
+
+    void SolverServer::_serveConnection(Connection& connection)
+    {
+        try
+        {
+            Frame request{};
+            while (readFrame(connection.fd, request))
+            {
+                const auto response{solve(request)};
+                writeFrame(connection.fd, response.kind, response.payload);
+            }
+        }
+        catch (const std::exception&)
+        {
+            // broken or malformed connection, drop the client
+        }
+
+        std::lock_guard lock{m_mutex};
+        ::close(connection.fd);
+        connection.finished = true;
+    }
+
+    void SolverServer::_reapConnections(bool all)
+    {
+        std::list<Connection> done{};
+        {
+            std::lock_guard lock{m_mutex};
+            for (auto it = m_connections.begin(); it != m_connections.end();)
+            {
+                const auto next{std::next(it)};
+                if (all || it->finished)
+                {
+                    done.splice(done.end(), m_connections, it);
+                }
+                it = next;
+            }
+        }
+
+        for (auto& connection : done)
+        {
+            connection.thread.join();
+        }
+    }
+
+    std::vector<Triplet> SolverServer::_parse(const Frame& request, std::string& diagnostics)
+    {
+        std::vector<Triplet> triplets{};
+        if (request.kind == static_cast<uint8_t>(PayloadFormat::Text))
+        {
+            PayloadBuffer buffer{request.payload};
+            std::istream stream{&buffer};
+            cli_parser::StreamParser parser{stream, cli_parser::StreamParser::DEFAULT_CHUNK_SIZE, 1, &diagnostics};
+
+            std::vector<Triplet> chunk{};
+            while (parser.next(chunk))
+            {
+                triplets.insert(triplets.end(), chunk.begin(), chunk.end());
+            }
+            return triplets;
+        }
+
+        if (request.kind == static_cast<uint8_t>(PayloadFormat::Binary))
+        {
+            if (request.payload.size() % io::BINARY_TRIPLETS_RECORD_SIZE != 0)
+            {
+                throw std::invalid_argument("Invalid input: binary payload size must be a multiple of 24");
+            }
+
+            const auto* records{reinterpret_cast<const std::byte*>(request.payload.data())};
+            const auto count{request.payload.size() / io::BINARY_TRIPLETS_RECORD_SIZE};
+            triplets.reserve(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const std::byte* record{records + i * io::BINARY_TRIPLETS_RECORD_SIZE};
+                triplets.push_back({
+                    io::loadLittleEndian<int64_t>(record),
+                    io::loadLittleEndian<int64_t>(record + sizeof(int64_t)),
+                    io::loadLittleEndian<int64_t>(record + 2 * sizeof(int64_t)),
+                    static_cast<int64_t>(i),
+                });
+            }
+            return triplets;
+        }
+
+        throw std::invalid_argument("Invalid input: unknown payload format " + std::to_string(request.kind));
+    }
+}
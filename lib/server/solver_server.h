@@ -0,0 +1,120 @@
+#ifndef SOLVER_SERVER_H
+#define SOLVER_SERVER_H
+
+#include "cache/solution_cache.h"
+#include "queue/blocking_queue.h"
+#include "server/protocol.h"
+#include "server/request_table.h"
+#include "thread/thread_pool.h"
+#include "utils/types/types.h"
+
+#include <list>
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace tektask::server
+{
+    /**
+     * @class SolverServer
+     * @brief Long-running solver, keeps resolvers alive between requests.
+     *
+     * Resolvers run on the pool workers for the whole server lifetime and consume
+     * a single shared queue, triplets of concurrent requests are batched together.
+     * Every client connection is served by its own thread: the request is parsed
+     * and validated with the CLI rules, queued, and the response is formatted in
+     * input order once all its solutions are published.
+     */
+    class SolverServer
+    {
+    public:
+        // number of triplets enqueued under a single queue lock
+        static constexpr std::size_t PUSH_BATCH_SIZE{1024};
+
+        /**
+         * @brief Starts resolvers on every pool worker.
+         *
+         * @param pool Resolver workers, busy until the server is destroyed.
+         * @param cache Solution cache shared between resolvers, nullptr disables caching.
+         */
+        explicit SolverServer(thread::ThreadPool& pool, cache::SolutionCache* cache = nullptr);
+
+        /**
+         * @brief Stops serving and waits for resolvers.
+         */
+        ~SolverServer();
+
+        SolverServer(const SolverServer&) = delete;
+        SolverServer(SolverServer&&) = delete;
+        SolverServer& operator=(const SolverServer&) = delete;
+        SolverServer& operator=(SolverServer&&) = delete;
+
+        /**
+         * @brief Solves a single request.
+         *
+         * @param request Request frame, kind is the PayloadFormat.
+         * @return Response frame, its payload is the text se_solver prints for the same input,
+         * or diagnostics followed by the error message.
+         */
+        Frame solve(const Frame& request);
+
+        /**
+         * @brief Accepts connections on the Unix domain socket until stop() is called.
+         *
+         * Existing socket file at the path is replaced, and removed on return.
+         *
+         * @throws std::invalid_argument if something other than a socket exists at the path.
+         * @throws if the socket can't be created.
+         */
+        void serve(const std::string& socketPath);
+
+        /**
+         * @brief Makes serve() return, closes client connections. Safe to call from any thread.
+         */
+        void stop();
+
+    private:
+        /**
+         * @brief Client connection, finished ones are joined by the accept loop.
+         */
+        struct Connection
+        {
+            int fd{-1};
+            std::thread thread{};
+            bool finished{false};
+        };
+
+        /**
+         * @brief Answers requests of a single client until it disconnects.
+         */
+        void _serveConnection(Connection& connection);
+
+        /**
+         * @brief Joins threads of disconnected clients.
+         *
+         * @param all Waits for every connection, not only the finished ones.
+         */
+        void _reapConnections(bool all);
+
+        /**
+         * @brief Parses request payload into triplets with sequential ids, collects diagnostics.
+         *
+         * @throws if the payload format is unknown or binary payload is truncated.
+         */
+        static std::vector<utils::types::Triplet> _parse(const Frame& request, std::string& diagnostics);
+
+        thread::ThreadPool& m_pool;
+        queue::BlockingQueue<utils::types::Triplet> m_queue{};
+        RequestTable m_table{};
+
+        std::mutex m_mutex{};
+        std::list<Connection> m_connections{};
+        int m_listenFd{-1};
+        std::atomic<bool> m_stopping{false};
+    };
+}
+
+#endif //SOLVER_SERVER_H
@@ -0,0 +1,124 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <array>
+#include <limits>
+#include <cstdint>
+#include <algorithm>
+
+namespace tektask::stats
+{
+    /**
+     * @class Histogram
+     * @brief Fixed size latency histogram with power of two nanosecond buckets.
+     *
+     * Bucket i holds values in [2^(i-1), 2^i), bucket 0 holds zeros. Recording is
+     * a few instructions and never allocates, histograms of different threads are merged later.
+     * Not thread-safe, every thread records into its own instance.
+     */
+    class Histogram
+    {
+    public:
+        static constexpr std::size_t BUCKET_COUNT{64};
+
+        /**
+         * @brief Records a value, weight times, e.g. average latency of items measured together.
+         *
+         * @param value Latency in nanoseconds.
+         * @param weight Number of occurrences.
+         */
+        void record(uint64_t value, uint64_t weight = 1) noexcept
+        {
+            m_buckets[_bucket(value)] += weight;
+            m_count += weight;
+            m_sum += value * weight;
+            m_min = std::min(m_min, value);
+            m_max = std::max(m_max, value);
+        }
+
+        /**
+         * @brief Adds all values of other histogram.
+         */
+        void merge(const Histogram& other) noexcept
+        {
+            for (std::size_t i = 0; i < BUCKET_COUNT; ++i)
+            {
+                m_buckets[i] += other.m_buckets[i];
+            }
+            m_count += other.m_count;
+            m_sum += other.m_sum;
+            m_min = std::min(m_min, other.m_min);
+            m_max = std::max(m_max, other.m_max);
+        }
+
+        [[nodiscard]] uint64_t count() const noexcept
+        {
+            return m_count;
+        }
+
+        [[nodiscard]] uint64_t sum() const noexcept
+        {
+            return m_sum;
+        }
+
+        [[nodiscard]] uint64_t min() const noexcept
+        {
+            return m_count == 0 ? 0 : m_min;
+        }
+
+        [[nodiscard]] uint64_t max() const noexcept
+        {
+            return m_max;
+        }
+
+        [[nodiscard]] uint64_t mean() const noexcept
+        {
+            return m_count == 0 ? 0 : m_sum / m_count;
+        }
+
+        /**
+         * @brief Approximates a percentile by the upper bound of its bucket, clamped to the observed range.
+         *
+         * @param fraction Percentile in [0, 1], e.g. 0.99.
+         */
+        [[nodiscard]] uint64_t percentile(double fraction) const noexcept
+        {
+            if (m_count == 0)
+            {
+                return 0;
+            }
+
+            const auto rank{std::max<uint64_t>(1, static_cast<uint64_t>(fraction * static_cast<double>(m_count)))};
+            uint64_t seen{0};
+            for (std::size_t i = 0; i < BUCKET_COUNT; ++i)
+            {
+                seen += m_buckets[i];
+                if (seen >= rank)
+                {
+                    const auto upper{i + 1 == BUCKET_COUNT ? m_max : (uint64_t{1} << i) - 1};
+                    return std::clamp(upper, min(), m_max);
+                }
+            }
+            return m_max;
+        }
+
+    private:
+        static std::size_t _bucket(uint64_t value) noexcept
+        {
+            if (value == 0)
+            {
+                return 0;
+            }
+            const auto bits{static_cast<std::size_t>(64 - __builtin_clzll(value))};
+            return std::min(bits, BUCKET_COUNT - 1);
+        }
+
+        std::array<uint64_t, BUCKET_COUNT> m_buckets{};
+        uint64_t m_count{0};
+        uint64_t m_sum{0};
+        uint64_t m_min{std::numeric_limits<uint64_t>::max()};
+        uint64_t m_max{0};
+    };
+}
+
+#endif //HISTOGRAM_H
@@ -0,0 +1,143 @@
+#include "stats.h"
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <iomanip>
+
+
+namespace tektask::stats
+{
+    namespace
+    {
+        constexpr std::array<const char*, STAGE_COUNT> STAGE_NAMES{"parse", "queue_wait", "resolve", "output"};
+
+        constexpr std::array<const char*, COUNTER_COUNT> COUNTER_NAMES{
+            "parsed_triplets", "invalid_triplets", "lock_waits", "empty_queue_waits", "full_queue_waits", "steals",
+            "cache_hits", "cache_misses",
+            "infinite_roots", "no_solution", "linear", "no_real_roots", "single_root", "two_roots",
+        };
+
+        // push times of sampled ids, a slot is reused every STAMP_SLOTS samples
+        constexpr std::size_t STAMP_SLOTS{4096};
+
+        /**
+         * @brief Owns statistics of every thread that ever recorded something.
+         */
+        struct Registry
+        {
+            std::mutex mutex{};
+            std::vector<std::unique_ptr<ThreadStats>> threads{};
+            std::array<std::atomic<uint64_t>, STAMP_SLOTS> stamps{};
+        };
+
+        Registry& registry()
+        {
+            static Registry instance{};
+            return instance;
+        }
+
+        std::size_t stampSlot(int64_t id) noexcept
+        {
+            return static_cast<std::size_t>(id / QUEUE_SAMPLE_RATE) % STAMP_SLOTS;
+        }
+    }
+
+    namespace detail
+    {
+        ThreadStats& local()
+        {
+            thread_local ThreadStats* stats{nullptr};
+            if (stats == nullptr)
+            {
+                auto& instance{registry()};
+                std::lock_guard lock(instance.mutex);
+                stats = instance.threads.emplace_back(std::make_unique<ThreadStats>()).get();
+            }
+            return *stats;
+        }
+
+        void stampPushed(int64_t id, uint64_t now) noexcept
+        {
+            registry().stamps[stampSlot(id)].store(now, std::memory_order_relaxed);
+        }
+
+        uint64_t pushedAt(int64_t id) noexcept
+        {
+            return registry().stamps[stampSlot(id)].load(std::memory_order_relaxed);
+        }
+    }
+
+    Report collect()
+    {
+        Report report{};
+        auto& instance{registry()};
+        std::lock_guard lock(instance.mutex);
+        for (const auto& thread : instance.threads)
+        {
+            for (std::size_t i = 0; i < STAGE_COUNT; ++i)
+            {
+                report.stages[i].merge(thread->stages[i]);
+            }
+            for (std::size_t i = 0; i < COUNTER_COUNT; ++i)
+            {
+                report.counters[i] += thread->counters[i];
+            }
+        }
+        report.threadCount = instance.threads.size();
+        return report;
+    }
+
+    void printReport(const Report& report, std::ostream& out)
+    {
+        if constexpr (!STATS_COMPILED_IN)
+        {
+            out << "stats: instrumentation is compiled out" << std::endl;
+            return;
+        }
+
+        out << "stats: " << report.threadCount << " threads\n";
+        out << std::left << std::setw(12) << "stage" << std::right
+            << std::setw(12) << "count" << std::setw(14) << "total_ms" << std::setw(12) << "mean_ns"
+            << std::setw(12) << "p50_ns" << std::setw(12) << "p90_ns" << std::setw(12) << "p99_ns"
+            << std::setw(14) << "max_ns" << "\n";
+        for (std::size_t i = 0; i < STAGE_COUNT; ++i)
+        {
+            const auto& stage{report.stages[i]};
+            out << std::left << std::setw(12) << STAGE_NAMES[i] << std::right
+                << std::setw(12) << stage.count()
+                << std::setw(14) << std::fixed << std::setprecision(3) << static_cast<double>(stage.sum()) / 1e6
+                << std::setw(12) << stage.mean() << std::setw(12) << stage.percentile(0.5)
+                << std::setw(12) << stage.percentile(0.9) << std::setw(12) << stage.percentile(0.99)
+                << std::setw(14) << stage.max() << "\n";
+        }
+        for (std::size_t i = 0; i < COUNTER_COUNT; ++i)
+        {
+            out << std::left << std::setw(20) << COUNTER_NAMES[i] << std::right << report.counters[i] << "\n";
+        }
+        out.flush();
+    }
+
+    void writeJson(const Report& report, std::ostream& out)
+    {
+        out << "{\"compiled_in\":" << (STATS_COMPILED_IN ? "true" : "false")
+            << ",\"threads\":" << report.threadCount << ",\"stages\":{";
+        for (std::size_t i = 0; i < STAGE_COUNT; ++i)
+        {
+            const auto& stage{report.stages[i]};
+            out << (i == 0 ? "" : ",") << "\"" << STAGE_NAMES[i] << "\":{"
+                << "\"count\":" << stage.count() << ",\"total_ns\":" << stage.sum()
+                << ",\"mean_ns\":" << stage.mean() << ",\"min_ns\":" << stage.min()
+                << ",\"p50_ns\":" << stage.percentile(0.5) << ",\"p90_ns\":" << stage.percentile(0.9)
+                << ",\"p99_ns\":" << stage.percentile(0.99) << ",\"max_ns\":" << stage.max() << "}";
+        }
+        out << "},\"counters\":{";
+        for (std::size_t i = 0; i < COUNTER_COUNT; ++i)
+        {
+            out << (i == 0 ? "" : ",") << "\"" << COUNTER_NAMES[i] << "\":" << report.counters[i];
+        }
+        out << "}}\n";
+        out.flush();
+    }
+}
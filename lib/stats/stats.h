@@ -0,0 +1,221 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include "stats/histogram.h"
+#include "utils/types/types.h"
+
+#include <array>
+#include <chrono>
+#include <algorithm>
+#include <string>
+#include <ostream>
+
+// instrumentation is compiled in unless the build disables it with TEKTASK_STATS=0
+#ifndef TEKTASK_STATS
+#define TEKTASK_STATS 1
+#endif
+
+namespace tektask::stats
+{
+    static constexpr bool STATS_COMPILED_IN{TEKTASK_STATS != 0};
+
+    /**
+     * @brief Pipeline stages with a latency histogram each.
+     */
+    enum class Stage : uint8_t
+    {
+        Parse, // parsing a command line or a single input chunk
+        QueueWait, // sampled time from push to pop of a single item
+        Resolve, // solving and storing a block, per equation
+        Output, // formatting and writing a single output write
+        Count
+    };
+
+    /**
+     * @brief Pipeline event counters, solve case counters follow SolveCase order.
+     */
+    enum class Counter : uint8_t
+    {
+        ParsedTriplets,
+        InvalidTriplets,
+        LockWaits, // BlockingQueue lock was held by another thread
+        EmptyQueueWaits, // consumer found the queue empty and had to sleep
+        FullQueueWaits, // producer found BlockingQueue full and had to sleep
+        Steals, // WorkStealingQueue consumer took a task from another consumer
+        CacheHits,
+        CacheMisses,
+        InfiniteRoots,
+        NoSolution,
+        Linear,
+        NoRealRoots,
+        SingleRoot,
+        TwoRoots,
+        Count
+    };
+
+    static constexpr std::size_t STAGE_COUNT{static_cast<std::size_t>(Stage::Count)};
+    static constexpr std::size_t COUNTER_COUNT{static_cast<std::size_t>(Counter::Count)};
+    static constexpr std::size_t SOLVE_CASE_COUNT{COUNTER_COUNT - static_cast<std::size_t>(Counter::InfiniteRoots)};
+
+    // every QUEUE_SAMPLE_RATE-th item id is timed from push to pop
+    static constexpr int64_t QUEUE_SAMPLE_RATE{1024};
+
+    /**
+     * @brief Statistics recorded by a single thread, written by the owner thread only.
+     */
+    struct ThreadStats
+    {
+        std::array<Histogram, STAGE_COUNT> stages{};
+        std::array<uint64_t, COUNTER_COUNT> counters{};
+    };
+
+    /**
+     * @brief Merged statistics of all threads.
+     */
+    struct Report
+    {
+        std::array<Histogram, STAGE_COUNT> stages{};
+        std::array<uint64_t, COUNTER_COUNT> counters{};
+        std::size_t threadCount{0};
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Returns statistics of the calling thread, registered on first use and kept after thread exit.
+         */
+        ThreadStats& local();
+
+        /**
+         * @brief Records push time of sampled ids.
+         */
+        void stampPushed(int64_t id, uint64_t now) noexcept;
+
+        /**
+         * @brief Returns push time of a sampled id, 0 if it was never stamped.
+         */
+        uint64_t pushedAt(int64_t id) noexcept;
+    }
+
+    /**
+     * @brief Monotonic clock in nanoseconds.
+     */
+    inline uint64_t now() noexcept
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    inline void count(Counter counter, uint64_t value = 1)
+    {
+        if constexpr (STATS_COMPILED_IN)
+        {
+            detail::local().counters[static_cast<std::size_t>(counter)] += value;
+        }
+    }
+
+    inline void countCase(utils::types::SolveCase kind, uint64_t value = 1)
+    {
+        count(static_cast<Counter>(static_cast<std::size_t>(Counter::InfiniteRoots) + static_cast<std::size_t>(kind)),
+              value);
+    }
+
+    inline void record(Stage stage, uint64_t nanoseconds, uint64_t weight = 1)
+    {
+        if constexpr (STATS_COMPILED_IN)
+        {
+            detail::local().stages[static_cast<std::size_t>(stage)].record(nanoseconds, weight);
+        }
+    }
+
+    /**
+     * @brief Stamps sampled ids of a pushed range, producer side.
+     */
+    inline void markPushed(int64_t first, int64_t last)
+    {
+        if constexpr (STATS_COMPILED_IN)
+        {
+            const auto time{now()};
+            for (auto id{(first + QUEUE_SAMPLE_RATE - 1) / QUEUE_SAMPLE_RATE * QUEUE_SAMPLE_RATE}; id < last;
+                 id += QUEUE_SAMPLE_RATE)
+            {
+                detail::stampPushed(id, time);
+            }
+        }
+    }
+
+    /**
+     * @brief Records queue wait of a popped item if its id is sampled, consumer side.
+     */
+    inline void markPopped(int64_t id)
+    {
+        if constexpr (STATS_COMPILED_IN)
+        {
+            if (id % QUEUE_SAMPLE_RATE == 0)
+            {
+                const auto pushed{detail::pushedAt(id)};
+                const auto time{now()};
+                if (pushed != 0 && time >= pushed)
+                {
+                    record(Stage::QueueWait, time - pushed);
+                }
+            }
+        }
+    }
+
+    /**
+     * @class ScopedTimer
+     * @brief Records the lifetime of the scope into the stage histogram.
+     *
+     * Scopes processing several items record the average per item, once per item,
+     * so stage count and total time stay exact.
+     */
+    class ScopedTimer
+    {
+    public:
+        explicit ScopedTimer(Stage stage, uint64_t items = 1) noexcept :
+            m_stage(stage),
+            m_items(std::max<uint64_t>(items, 1)),
+            m_start(STATS_COMPILED_IN ? now() : 0)
+        {
+        }
+
+        ~ScopedTimer()
+        {
+            if constexpr (STATS_COMPILED_IN)
+            {
+                const auto elapsed{now() - m_start};
+                record(m_stage, elapsed / m_items, m_items);
+            }
+        }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+        ScopedTimer(ScopedTimer&&) = delete;
+        ScopedTimer& operator=(ScopedTimer&&) = delete;
+
+    private:
+        Stage m_stage;
+        uint64_t m_items;
+        uint64_t m_start;
+    };
+
+    /**
+     * @brief Merges statistics of all threads seen so far.
+     *
+     * Has to be called after recording threads are joined.
+     */
+    Report collect();
+
+    /**
+     * @brief Prints a human-readable report.
+     */
+    void printReport(const Report& report, std::ostream& out);
+
+    /**
+     * @brief Writes the report as a JSON object.
+     */
+    void writeJson(const Report& report, std::ostream& out);
+}
+
+#endif //STATS_H
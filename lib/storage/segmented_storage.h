@@ -0,0 +1,99 @@
+#ifndef SEGMENTED_STORAGE_H
+#define SEGMENTED_STORAGE_H
+
+#include <memory>
+#include <cstddef>
+#include <stdexcept>
+
+namespace tektask::storage
+{
+    /**
+     * @class SegmentedStorage
+     * @brief Growable random access storage with stable element addresses.
+     *
+     * Elements are kept in fixed size segments, referenced from a preallocated
+     * segments directory, so growing never relocates already stored elements.
+     * It allows a producer to grow the storage while consumers write
+     * into previously published indexes, like resolvers do with Triplet::id.
+     *
+     * resize() is expected to be called by a single producer thread, before
+     * the new indexes are published to the consumers (e.g. through a queue).
+     *
+     * @tparam T Type of the stored elements.
+     * @tparam SegmentSize Number of elements in a single segment.
+     */
+    template <typename T, std::size_t SegmentSize = 64 * 1024>
+    class SegmentedStorage
+    {
+    public:
+        using value_type = T;
+
+        static constexpr std::size_t DEFAULT_MAX_SEGMENTS{64 * 1024};
+
+        /**
+         * @brief Constructs an empty storage.
+         *
+         * @param maxSegments Capacity of the segments directory.
+         */
+        explicit SegmentedStorage(std::size_t maxSegments = DEFAULT_MAX_SEGMENTS) :
+            m_segments(std::make_unique<std::unique_ptr<T[]>[]>(maxSegments)),
+            m_maxSegments(maxSegments)
+        {
+        }
+
+        ~SegmentedStorage() = default;
+        SegmentedStorage(const SegmentedStorage&) = delete;
+        SegmentedStorage& operator=(const SegmentedStorage&) = delete;
+        SegmentedStorage(SegmentedStorage&&) noexcept = default;
+        SegmentedStorage& operator=(SegmentedStorage&&) noexcept = default;
+
+        /**
+         * @brief Grows the storage, allocating missing segments.
+         *
+         * @param size New element count, shrinking is ignored.
+         *
+         * @throws if size exceeds the storage capacity.
+         */
+        void resize(std::size_t size)
+        {
+            if (size <= m_size)
+            {
+                return;
+            }
+
+            const auto segments{(size + SegmentSize - 1) / SegmentSize};
+            if (segments > m_maxSegments)
+            {
+                throw std::length_error("Segmented storage capacity exceeded");
+            }
+
+            for (auto i{(m_size + SegmentSize - 1) / SegmentSize}; i < segments; ++i)
+            {
+                m_segments[i] = std::make_unique<T[]>(SegmentSize);
+            }
+            m_size = size;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return m_size;
+        }
+
+        T& operator[](std::size_t index) noexcept
+        {
+            return m_segments[index / SegmentSize][index % SegmentSize];
+        }
+
+        const T& operator[](std::size_t index) const noexcept
+        {
+            return m_segments[index / SegmentSize][index % SegmentSize];
+        }
+
+    private:
+        std::unique_ptr<std::unique_ptr<T[]>[]> m_segments;
+        std::size_t m_maxSegments{0};
+        std::size_t m_size{0};
+    };
+}
+
+#endif //SEGMENTED_STORAGE_H
@@ -0,0 +1,92 @@
+#ifndef TEXT_ARENA_H
+#define TEXT_ARENA_H
+
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include <string_view>
+
+namespace tektask::storage
+{
+    /**
+     * @class TextArena
+     * @brief Append-only byte buffer for formatted results.
+     *
+     * Text is written into large blocks, a new block is allocated only when
+     * the current one is exhausted, so appending a result doesn't allocate
+     * in steady state. Blocks are never relocated, views returned by commit()
+     * stay valid for the arena lifetime.
+     *
+     * Not thread-safe, each writer thread is expected to own its arena.
+     */
+    class TextArena
+    {
+    public:
+        static constexpr std::size_t DEFAULT_BLOCK_SIZE{1024 * 1024};
+
+        /**
+         * @brief Constructs an empty arena, no memory is allocated until the first reserve().
+         *
+         * @param blockSize Size of a single block in bytes.
+         */
+        explicit TextArena(std::size_t blockSize = DEFAULT_BLOCK_SIZE) : m_blockSize(blockSize)
+        {
+        }
+
+        ~TextArena() = default;
+        TextArena(const TextArena&) = delete;
+        TextArena& operator=(const TextArena&) = delete;
+        TextArena(TextArena&&) noexcept = default;
+        TextArena& operator=(TextArena&&) noexcept = default;
+
+        /**
+         * @brief Provides a writable region of at least maxLength bytes.
+         *
+         * @param maxLength Upper bound of the text length to be written.
+         * @return Pointer to write text into, valid until the next reserve().
+         */
+        char* reserve(std::size_t maxLength)
+        {
+            if (static_cast<std::size_t>(m_end - m_cursor) < maxLength)
+            {
+                const auto size{std::max(m_blockSize, maxLength)};
+                m_blocks.emplace_back(std::make_unique<char[]>(size));
+                m_cursor = m_blocks.back().get();
+                m_end = m_cursor + size;
+            }
+            return m_cursor;
+        }
+
+        /**
+         * @brief Commits text written into the region returned by the last reserve().
+         *
+         * @param length Number of written bytes, must not exceed reserved length.
+         * @return View of the committed text.
+         */
+        std::string_view commit(std::size_t length) noexcept
+        {
+            const std::string_view text{m_cursor, length};
+            m_cursor += length;
+            m_size += length;
+            return text;
+        }
+
+        /**
+         * @brief Total number of committed bytes.
+         */
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return m_size;
+        }
+
+    private:
+        std::vector<std::unique_ptr<char[]>> m_blocks{};
+        std::size_t m_blockSize{DEFAULT_BLOCK_SIZE};
+        char* m_cursor{nullptr};
+        char* m_end{nullptr};
+        std::size_t m_size{0};
+    };
+}
+
+#endif //TEXT_ARENA_H
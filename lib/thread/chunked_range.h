@@ -0,0 +1,93 @@
+#ifndef CHUNKED_RANGE_H
+#define CHUNKED_RANGE_H
+
+#include <atomic>
+#include <cstddef>
+#include <algorithm>
+
+
+namespace tektask::thread
+{
+    /**
+     * @class ChunkedRange
+     * @brief Parallel-for over a contiguous array of known size, without a queue.
+     *
+     * Workers claim index ranges from a single atomic counter and process items
+     * in place, nothing is pushed, popped or copied. Chunks are guided: every claim
+     * takes a share of the remaining items, large at first to keep claims rare,
+     * shrinking towards the end down to the minimum chunk, so workers finish together.
+     *
+     * Usable as resolver input in place of a queue, see QuadraticEquationResolver.
+     *
+     * @tparam T Type of the items.
+     */
+    template <typename T>
+    class ChunkedRange
+    {
+    public:
+        using value_type = T;
+
+        // share of the remaining items is 1 / (GUIDED_FACTOR * workers)
+        static constexpr std::size_t GUIDED_FACTOR{2};
+
+        /**
+         * @brief Constructs a range with all items available for claiming.
+         *
+         * @param items Pointer to the first item, the array must outlive the range.
+         * @param size Number of items.
+         * @param workerCount Number of claiming workers, sizes the guided chunks.
+         * @param minChunk Minimum chunk size, except for the last chunk.
+         */
+        explicit ChunkedRange(const T* items, std::size_t size, std::size_t workerCount, std::size_t minChunk) :
+            m_items(items),
+            m_size(size),
+            m_divisor(GUIDED_FACTOR * std::max<std::size_t>(workerCount, 1)),
+            m_minChunk(std::max<std::size_t>(minChunk, 1))
+        {
+        }
+
+        ~ChunkedRange() = default;
+        ChunkedRange(const ChunkedRange&) = delete;
+        ChunkedRange& operator=(const ChunkedRange&) = delete;
+
+        /**
+         * @brief Claims the next chunk of items.
+         *
+         * @param items Set to the first item of the chunk.
+         * @param count Set to the number of items in the chunk.
+         * @return true if a chunk was claimed, false if the range is exhausted.
+         */
+        bool claim(const T*& items, std::size_t& count) noexcept
+        {
+            auto first{m_next.load(std::memory_order_relaxed)};
+            do
+            {
+                if (first >= m_size)
+                {
+                    return false;
+                }
+
+                const auto remaining{m_size - first};
+                count = std::min(remaining, std::max(m_minChunk, remaining / m_divisor));
+            }
+            while (!m_next.compare_exchange_weak(first, first + count, std::memory_order_relaxed));
+
+            items = m_items + first;
+            return true;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return m_size;
+        }
+
+    private:
+        const T* m_items{nullptr};
+        const std::size_t m_size{0};
+        const std::size_t m_divisor{1};
+        const std::size_t m_minChunk{1};
+        std::atomic<std::size_t> m_next{0};
+    };
+}
+
+#endif //CHUNKED_RANGE_H
@@ -0,0 +1,244 @@
+#include "cpu_topology.h"
+
+#include <string>
+#include <fstream>
+#include <charconv>
+#include <algorithm>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <sched.h>
+#include <pthread.h>
+#endif
+
+
+namespace tektask::thread
+{
+    namespace
+    {
+        // sysfs is scanned up to this node, machines with more nodes are rare enough to ignore
+        constexpr int MAX_NODES{64};
+
+        // largest CPU index accepted from a list or a mask
+        constexpr int MAX_CPU{4095};
+
+        [[noreturn]] void invalidList(std::string_view text)
+        {
+            throw std::invalid_argument("Invalid input: invalid cpu list " + std::string{text});
+        }
+
+        int parseCpu(std::string_view text, std::string_view list)
+        {
+            int cpu{0};
+            const char* end{text.data() + text.size()};
+            const auto result{std::from_chars(text.data(), end, cpu)};
+            if (text.empty() || result.ec != std::errc{} || result.ptr != end || cpu < 0 || cpu > MAX_CPU)
+            {
+                invalidList(list);
+            }
+            return cpu;
+        }
+
+        std::vector<int> parseCpuMask(std::string_view text, std::string_view list)
+        {
+            std::vector<int> cpus{};
+            int bit{0};
+            for (auto it = text.rbegin(); it != text.rend(); ++it, bit += 4)
+            {
+                int nibble{0};
+                const auto [ptr, ec]{std::from_chars(&*it, &*it + 1, nibble, 16)};
+                if (ec != std::errc{} || bit > MAX_CPU)
+                {
+                    invalidList(list);
+                }
+                for (int i = 0; i < 4; ++i)
+                {
+                    if ((nibble & (1 << i)) != 0)
+                    {
+                        cpus.push_back(bit + i);
+                    }
+                }
+            }
+            std::sort(cpus.begin(), cpus.end());
+            return cpus;
+        }
+
+        std::vector<int> readCpuList(const std::string& path)
+        {
+            std::ifstream file{path};
+            std::string text{};
+            if (!file || !std::getline(file, text) || text.empty())
+            {
+                return {};
+            }
+            try
+            {
+                return parseCpuList(text);
+            }
+            catch (const std::invalid_argument&)
+            {
+                return {};
+            }
+        }
+    }
+
+    std::vector<int> parseCpuList(std::string_view text)
+    {
+        if (text.size() > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X'))
+        {
+            auto cpus{parseCpuMask(text.substr(2), text)};
+            if (cpus.empty())
+            {
+                invalidList(text);
+            }
+            return cpus;
+        }
+
+        std::vector<int> cpus{};
+        std::size_t begin{0};
+        while (begin <= text.size())
+        {
+            const auto end{std::min(text.find(',', begin), text.size())};
+            const auto item{text.substr(begin, end - begin)};
+            const auto dash{item.find('-')};
+            if (dash == std::string_view::npos)
+            {
+                cpus.push_back(parseCpu(item, text));
+            }
+            else
+            {
+                const auto first{parseCpu(item.substr(0, dash), text)};
+                const auto last{parseCpu(item.substr(dash + 1), text)};
+                if (first > last)
+                {
+                    invalidList(text);
+                }
+                for (int cpu = first; cpu <= last; ++cpu)
+                {
+                    cpus.push_back(cpu);
+                }
+            }
+            begin = end + 1;
+        }
+
+        std::sort(cpus.begin(), cpus.end());
+        cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+        return cpus;
+    }
+
+    CpuTopology CpuTopology::detect()
+    {
+        std::vector<int> allowed{};
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (sched_getaffinity(0, sizeof(set), &set) == 0)
+        {
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+            {
+                if (CPU_ISSET(cpu, &set))
+                {
+                    allowed.push_back(cpu);
+                }
+            }
+        }
+#endif
+
+        std::vector<int> nodes{};
+        for (int node = 0; node < MAX_NODES; ++node)
+        {
+            for (const auto cpu : readCpuList("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"))
+            {
+                if (static_cast<std::size_t>(cpu) >= nodes.size())
+                {
+                    nodes.resize(cpu + 1, 0);
+                }
+                nodes[cpu] = node;
+            }
+        }
+
+        return {std::move(allowed), std::move(nodes)};
+    }
+
+    CpuTopology::CpuTopology(std::vector<int> allowedCpus, std::vector<int> cpuNodes) :
+        m_allowedCpus(std::move(allowedCpus)),
+        m_cpuNodes(std::move(cpuNodes))
+    {
+        std::sort(m_allowedCpus.begin(), m_allowedCpus.end());
+    }
+
+    int CpuTopology::nodeOf(int cpu) const noexcept
+    {
+        if (cpu < 0 || static_cast<std::size_t>(cpu) >= m_cpuNodes.size())
+        {
+            return 0;
+        }
+        return m_cpuNodes[cpu];
+    }
+
+    std::vector<int> CpuTopology::place(const std::vector<int>& cpus, uint32_t workerCount, int firstCpu) const
+    {
+        auto candidates{cpus.empty() ? m_allowedCpus : cpus};
+        if (candidates.empty() || workerCount == 0)
+        {
+            return {};
+        }
+
+        for (const auto cpu : candidates)
+        {
+            if (!m_allowedCpus.empty() && !std::binary_search(m_allowedCpus.begin(), m_allowedCpus.end(), cpu))
+            {
+                throw std::invalid_argument("Invalid input: cpu " + std::to_string(cpu) + " is not available");
+            }
+        }
+
+        // group by node, the producer node goes first, CPUs keep ascending order inside a node
+        const auto firstNode{nodeOf(firstCpu)};
+        std::stable_sort(candidates.begin(), candidates.end(), [this, firstNode](int lhs, int rhs)
+        {
+            const auto lhsNode{nodeOf(lhs)};
+            const auto rhsNode{nodeOf(rhs)};
+            if ((lhsNode == firstNode) != (rhsNode == firstNode))
+            {
+                return lhsNode == firstNode;
+            }
+            return lhsNode < rhsNode;
+        });
+
+        std::vector<int> placement(workerCount);
+        for (uint32_t i = 0; i < workerCount; ++i)
+        {
+            placement[i] = candidates[i % candidates.size()];
+        }
+        return placement;
+    }
+
+    bool setCurrentThreadAffinity(const std::vector<int>& cpus) noexcept
+    {
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (const auto cpu : cpus)
+        {
+            if (cpu < 0 || cpu >= CPU_SETSIZE)
+            {
+                return false;
+            }
+            CPU_SET(cpu, &set);
+        }
+        return !cpus.empty() && pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+        (void)cpus;
+        return false;
+#endif
+    }
+
+    int currentCpu() noexcept
+    {
+#ifdef __linux__
+        return sched_getcpu();
+#else
+        return -1;
+#endif
+    }
+}
@@ -0,0 +1,88 @@
+#ifndef CPU_TOPOLOGY_H
+#define CPU_TOPOLOGY_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+
+
+namespace tektask::thread
+{
+    /**
+     * @brief Parses a CPU list like "0-3,8,10-11" or a hex mask like "0xf0f".
+     *
+     * @param text CPU list or mask.
+     * @return Sorted unique CPU indices.
+     *
+     * @throws if the text is malformed or selects no CPUs.
+     */
+    std::vector<int> parseCpuList(std::string_view text);
+
+    /**
+     * @class CpuTopology
+     * @brief CPUs the process may run on and the NUMA node of every CPU.
+     *
+     * Node information comes from /sys/devices/system/node, machines without it
+     * are treated as a single node.
+     */
+    class CpuTopology
+    {
+    public:
+        /**
+         * @brief Reads the topology of the current machine and process affinity.
+         */
+        static CpuTopology detect();
+
+        /**
+         * @brief Constructs a topology from known values, CPUs missing from cpuNodes are on node 0.
+         *
+         * @param allowedCpus CPUs the process may run on.
+         * @param cpuNodes NUMA node by CPU index.
+         */
+        CpuTopology(std::vector<int> allowedCpus, std::vector<int> cpuNodes);
+
+        [[nodiscard]] const std::vector<int>& allowedCpus() const noexcept
+        {
+            return m_allowedCpus;
+        }
+
+        [[nodiscard]] int nodeOf(int cpu) const noexcept;
+
+        /**
+         * @brief Picks a CPU for every worker, NUMA compact.
+         *
+         * Workers fill the CPUs of one node before spilling to the next one, starting
+         * from the node of firstCpu (the producer), so threads sharing queues and
+         * result storage stay on one socket while it has room. More workers than CPUs
+         * wrap around.
+         *
+         * @param cpus Requested CPUs, all allowed CPUs if empty.
+         * @param workerCount Number of workers to place.
+         * @param firstCpu CPU the producer runs on, -1 if unknown.
+         * @return CPU by worker index.
+         *
+         * @throws if a requested CPU is not allowed for the process.
+         */
+        [[nodiscard]] std::vector<int> place(const std::vector<int>& cpus, uint32_t workerCount,
+                                             int firstCpu = -1) const;
+
+    private:
+        std::vector<int> m_allowedCpus;
+        std::vector<int> m_cpuNodes;
+    };
+
+    /**
+     * @brief Restricts the calling thread to the given CPUs, threads it starts later inherit the set.
+     *
+     * @return false if affinity is not supported or the call failed.
+     */
+    bool setCurrentThreadAffinity(const std::vector<int>& cpus) noexcept;
+
+    /**
+     * @brief CPU the calling thread currently runs on, -1 if unknown.
+     */
+    int currentCpu() noexcept;
+}
+
+#endif //CPU_TOPOLOGY_H
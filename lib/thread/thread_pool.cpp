@@ -0,0 +1,104 @@
+#include "thread_pool.h"
+#include "cpu_topology.h"
+
+#include <utility>
+#include <algorithm>
+
+
+namespace tektask::thread
+{
+    ThreadPool::ThreadPool(uint32_t threadCount, std::vector<int> cpus) :
+        m_cpus(std::move(cpus))
+    {
+        const auto count{std::max<uint32_t>(threadCount, 1)};
+        m_cpus.resize(m_cpus.empty() ? 0 : count, -1);
+
+        m_workers.reserve(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            m_workers.emplace_back(&ThreadPool::_work, this, i);
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::unique_lock lock{m_mutex};
+            m_finished.wait(lock, [this] { return m_running == 0; });
+            m_stopping = true;
+        }
+        m_started.notify_all();
+
+        for (auto& worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    void ThreadPool::start(Task task)
+    {
+        {
+            std::unique_lock lock{m_mutex};
+            m_finished.wait(lock, [this] { return m_running == 0; });
+            m_task = std::move(task);
+            m_running = size();
+            ++m_generation;
+        }
+        m_started.notify_all();
+    }
+
+    void ThreadPool::wait()
+    {
+        std::unique_lock lock{m_mutex};
+        m_finished.wait(lock, [this] { return m_running == 0; });
+        if (m_error)
+        {
+            std::rethrow_exception(std::exchange(m_error, nullptr));
+        }
+    }
+
+    void ThreadPool::_work(uint32_t worker)
+    {
+        const auto cpu{cpuOf(worker)};
+        if (cpu >= 0)
+        {
+            setCurrentThreadAffinity({cpu});
+        }
+
+        uint64_t seen{0};
+        while (true)
+        {
+            Task task{};
+            {
+                std::unique_lock lock{m_mutex};
+                m_started.wait(lock, [this, seen] { return m_stopping || m_generation != seen; });
+                if (m_stopping)
+                {
+                    return;
+                }
+                seen = m_generation;
+                task = m_task;
+            }
+
+            std::exception_ptr error{};
+            try
+            {
+                task(worker);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+
+            {
+                std::lock_guard lock{m_mutex};
+                if (error && !m_error)
+                {
+                    m_error = error;
+                }
+                --m_running;
+            }
+            m_finished.notify_all();
+        }
+    }
+}
@@ -0,0 +1,164 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+
+
+namespace tektask::thread
+{
+    /**
+     * @class ThreadPool
+     * @brief Fixed set of persistent worker threads, optionally pinned to CPUs.
+     *
+     * Every start() runs the same task once on every worker, with the worker index
+     * as argument, wait() blocks until all of them return. Pinned workers set their
+     * affinity before running anything, so memory they allocate and touch first is
+     * placed on their own NUMA node.
+     */
+    class ThreadPool
+    {
+    public:
+        using Task = std::function<void(uint32_t)>;
+
+        /**
+         * @brief Starts the workers.
+         *
+         * @param threadCount Number of workers, at least one is started.
+         * @param cpus CPU by worker index, workers are left unpinned if empty.
+         */
+        explicit ThreadPool(uint32_t threadCount, std::vector<int> cpus = {});
+
+        /**
+         * @brief Waits for the running task and joins the workers.
+         */
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool(ThreadPool&&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+        ThreadPool& operator=(ThreadPool&&) = delete;
+
+        [[nodiscard]] uint32_t size() const noexcept
+        {
+            return static_cast<uint32_t>(m_workers.size());
+        }
+
+        /**
+         * @brief CPU the worker is pinned to, -1 if it is not pinned.
+         */
+        [[nodiscard]] int cpuOf(uint32_t worker) const noexcept
+        {
+            return worker < m_cpus.size() ? m_cpus[worker] : -1;
+        }
+
+        /**
+         * @brief Runs the task on every worker, returns immediately.
+         *
+         * Waits for the previous task first, if it is still running.
+         */
+        void start(Task task);
+
+        /**
+         * @brief Blocks until every worker finished the current task.
+         *
+         * @throws the first exception thrown by the task, if any.
+         */
+        void wait();
+
+        /**
+         * @brief Runs the task on every worker and waits for completion.
+         */
+        void run(Task task)
+        {
+            start(std::move(task));
+            wait();
+        }
+
+    private:
+        /**
+         * @brief Worker loop, runs every new task generation until the pool stops.
+         */
+        void _work(uint32_t worker);
+
+        std::vector<std::thread> m_workers{};
+        std::vector<int> m_cpus{};
+
+        std::mutex m_mutex{};
+        std::condition_variable m_started{};
+        std::condition_variable m_finished{};
+        Task m_task{};
+        uint64_t m_generation{0};
+        uint32_t m_running{0};
+        bool m_stopping{false};
+        std::exception_ptr m_error{};
+    };
+
+    /**
+     * @brief Runs part tasks in parallel, the calling thread takes the first part.
+     *
+     * With a pool the other parts are spread over its persistent workers, the pool
+     * must be idle. Without one every other part gets its own thread.
+     *
+     * @param partCount Number of parts.
+     * @param task Callable taking the part index.
+     * @param pool Workers for the other parts, nullptr starts threads.
+     */
+    template <typename Task>
+    void runParts(std::size_t partCount, Task&& task, ThreadPool* pool = nullptr)
+    {
+        if (pool != nullptr && partCount > 1)
+        {
+            pool->start([&task, partCount, stride = std::size_t{pool->size()}](uint32_t worker)
+            {
+                for (auto i{std::size_t{worker} + 1}; i < partCount; i += stride)
+                {
+                    task(i);
+                }
+            });
+
+            // workers use the caller's state, they have to finish before it is gone
+            try
+            {
+                task(std::size_t{0});
+            }
+            catch (...)
+            {
+                try
+                {
+                    pool->wait();
+                }
+                catch (...)
+                {
+                }
+                throw;
+            }
+            pool->wait();
+            return;
+        }
+
+        std::vector<std::thread> threads;
+        threads.reserve(partCount > 0 ? partCount - 1 : 0);
+        for (std::size_t i = 1; i < partCount; ++i)
+        {
+            threads.emplace_back(task, i);
+        }
+        if (partCount > 0)
+        {
+            task(std::size_t{0});
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+}
+
+#endif //THREAD_POOL_H
@@ -0,0 +1,73 @@
+#ifndef BACKOFF_H
+#define BACKOFF_H
+
+#include <thread>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace tektask::utils::backoff
+{
+    /**
+     * @brief Hints the CPU that the thread is busy-waiting.
+     */
+    inline void cpuRelax() noexcept
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        __asm__ __volatile__("yield");
+#endif
+    }
+
+    /**
+     * @class Backoff
+     * @brief Exponential busy-wait backoff for lock-free retry loops.
+     *
+     * Spins with CPU relax hints, doubling the spin count on every call,
+     * and falls back to yielding the time slice once the spin limit is reached.
+     */
+    class Backoff
+    {
+    public:
+        static constexpr uint32_t SPIN_LIMIT{64};
+
+        /**
+         * @brief Waits a bit before the next retry.
+         */
+        void pause() noexcept
+        {
+            if (m_spins >= SPIN_LIMIT)
+            {
+                std::this_thread::yield();
+                return;
+            }
+
+            for (uint32_t i = 0; i < m_spins; ++i)
+            {
+                cpuRelax();
+            }
+            m_spins *= 2;
+        }
+
+        /**
+         * @brief true once spinning is over and the waiter yields its time slice.
+         */
+        [[nodiscard]] bool isYielding() const noexcept
+        {
+            return m_spins >= SPIN_LIMIT;
+        }
+
+        void reset() noexcept
+        {
+            m_spins = 1;
+        }
+
+    private:
+        uint32_t m_spins{1};
+    };
+}
+
+#endif //BACKOFF_H
@@ -5,6 +5,7 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
 
 
 namespace tektask::utils::types
@@ -29,30 +30,127 @@ namespace tektask::utils::types
         }
     };
 
+    /**
+     * @enum SolveCase
+     * @brief Kind of the quadratic equation solution.
+     */
+    enum class SolveCase : uint8_t
+    {
+        InfiniteRoots, ///< a == b == c == 0
+        NoSolution,    ///< a == b == 0, c != 0
+        Linear,        ///< a == 0, b != 0; single root x1, no extremum
+        NoRealRoots,   ///< D < 0; extremum only
+        SingleRoot,    ///< D == 0; single root x1 and extremum
+        TwoRoots,      ///< D > 0; roots x1, x2 and extremum
+    };
+
+    /**
+     * @struct EquationSolution
+     * @brief Numeric solution of a single quadratic equation.
+     *
+     * Compact structured result, 32 bytes, text is produced from it only if needed.
+     * Fields which are not defined for the solution kind are zero,
+     * xMin is normalized, so it's never -0.0.
+     */
+    struct EquationSolution
+    {
+        SolveCase kind{SolveCase::InfiniteRoots};
+        double x1{0.0};
+        double x2{0.0};
+        double xMin{0.0};
+
+        bool operator==(const EquationSolution& other) const noexcept
+        {
+            return kind == other.kind && x1 == other.x1 && x2 == other.x2 && xMin == other.xMin;
+        }
+    };
+
+    /**
+     * @enum InputFormat
+     * @brief Format of the streaming input source.
+     */
+    enum class InputFormat : uint8_t
+    {
+        Text,   ///< whitespace/newline separated decimal coefficients
+        Binary, ///< memory mapped fixed-width little-endian records
+    };
+
+    /**
+     * @enum OutputFormat
+     * @brief Format of the results output.
+     */
+    enum class OutputFormat : uint8_t
+    {
+        Text,   ///< human-readable lines, like "(1, -2, -3) => (3, -1), Xmin=1"
+        Binary, ///< fixed-width little-endian records, one per input triplet
+    };
+
+    /**
+     * @enum QueueKind
+     * @brief Resolver input queue implementation.
+     */
+    enum class QueueKind : uint8_t
+    {
+        Blocking, ///< mutex and condition variable based BlockingQueue
+        LockFree, ///< bounded lock-free MPMC LockFreeQueue
+        WorkStealing, ///< per-consumer Chase-Lev deques with random-victim stealing, WorkStealingQueue
+    };
+
+    /**
+     * @enum ExecutionMode
+     * @brief How the execution plan of a job is chosen.
+     */
+    enum class ExecutionMode : uint8_t
+    {
+        Auto,     ///< by input size and source, with the calibrated planner thresholds
+        Serial,   ///< solved on the calling thread, no worker threads
+        Parallel, ///< resolver pool, chunked for in-memory inputs, streaming pipeline for text
+    };
+
     /**
      * @struct CliArgs
      * @brief Holds parsed command-line arguments.
      *
-     * Stores valid `Triplet` collection extracted from the command line.
+     * Stores valid `Triplet` collection extracted from the command line, with the ids
+     * of valid triplets following every rejected one, or the path of streaming input source ("-" stands for stdin) and its format,
+     * along with the pipeline configuration options.
      */
     struct CliArgs
     {
         std::vector<Triplet> triplets{};
+        std::vector<int64_t> rejected{};
+        std::string inputPath{};
+        InputFormat inputFormat{InputFormat::Text};
+        QueueKind queueKind{QueueKind::Blocking};
+        std::size_t cacheSize{0};
+        bool printStats{false};
+        std::string statsJsonPath{};
+        uint32_t threadCount{0};
+        std::vector<int> cpus{};
+        std::string socketPath{};
+        OutputFormat outputFormat{OutputFormat::Text};
+        std::string outputPath{};
+        ExecutionMode executionMode{ExecutionMode::Auto};
+        std::string plannerConfigPath{};
+        bool calibrate{false};
+        bool aggregate{false};
     };
 
     /**
      * @struct EquationSolveResult
      * @brief Stores the resolved output of a single equation.
      *
-     * Each instance corresponds to the output string generated by solving
+     * Each instance corresponds to the output text generated by solving
      * a given coefficients. Indexed externally by unique id, for example Triplet::id
      * to support parallel and ordered result collection.
      *
-     * Aligning to cache line size avoids false sharing in concurrent scenarios.
+     * The text itself lives in the resolver TextArena, which has to outlive the result.
+     * Results are not padded to cache lines: resolvers pop contiguous id blocks, so
+     * two of them can share a cache line at the block edges only.
      */
-    struct alignas(constants::CACHE_SIZE) EquationSolveResult
+    struct EquationSolveResult
     {
-        std::string result{};
+        std::string_view result{};
     };
 }
 #endif //TYPES_H
@@ -0,0 +1,237 @@
+#include "cache/solution_cache.h"
+#include "resolver/quadratic_resolver.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <cstring>
+
+using namespace testing;
+using namespace tektask::cache;
+using namespace tektask::resolver;
+using namespace tektask::utils::types;
+
+namespace
+{
+    class DummyQueue
+    {
+    public:
+        using value_type = Triplet;
+    };
+
+    constexpr int64_t MIN{std::numeric_limits<int64_t>::min()};
+    constexpr int64_t MAX{std::numeric_limits<int64_t>::max()};
+}
+
+
+TEST(SolutionCacheTest, Normalize)
+{
+    struct NormalizeCase
+    {
+        Triplet input{};
+        NormalizedKey expected{};
+    };
+
+    const std::vector<NormalizeCase> cases{
+        {{0, 0, 0}, {0, 0, 0}},
+        {{1, 2, 1}, {1, 2, 1}},
+        {{2, 4, 2}, {1, 2, 1}},
+        {{-8, -16, -8}, {1, 2, 1}},
+        {{-2, 4, -6}, {1, -2, 3}},
+        {{0, -4, 6}, {0, 2, -3}},
+        {{0, 0, -8}, {0, 0, 1}},
+        {{6, 0, 0}, {3, 0, 0}},
+
+        // other common factors change rounding, keys keep them
+        {{-3, -6, -3}, {3, 6, 3}},
+        {{33, -561, -924}, {33, -561, -924}},
+
+        // beyond the exact double range only the sign is normalized
+        {{int64_t{1} << 30, int64_t{1} << 31, 0}, {int64_t{1} << 30, int64_t{1} << 31, 0}},
+        {{-(int64_t{1} << 30), 0, 2}, {int64_t{1} << 30, 0, -2}},
+        {{MAX, MAX, MAX}, {MAX, MAX, MAX}},
+
+        // INT64_MIN can't be negated, keeps its sign
+        {{MIN, MIN, 0}, {MIN, MIN, 0}},
+        {{MIN, 1, 1}, {MIN, 1, 1}},
+        {{-1, MIN, 3}, {-1, MIN, 3}},
+    };
+
+    for (const auto& testCase : cases)
+    {
+        ASSERT_EQ(normalize(testCase.input), testCase.expected);
+    }
+}
+
+TEST(SolutionCacheTest, Orient_SignFlipMatchesDirectSolve)
+{
+    // zero roots keep the sign direct solving gives them
+    for (const Triplet t : {Triplet{-1, 3, -2}, Triplet{-7, -5, 11}, Triplet{0, -2, 4}, Triplet{-1, 2, -1},
+                            Triplet{-17, -15, 0}, Triplet{-17, 15, 0}, Triplet{0, -3, 0}, Triplet{-5, 0, 0}})
+    {
+        const auto key{normalize(t)};
+        const auto normalized{solve(static_cast<double>(key.a), static_cast<double>(key.b), static_cast<double>(key.c))};
+        const auto oriented{orient(t, key, normalized)};
+        const auto direct{solve(static_cast<double>(t.a), static_cast<double>(t.b), static_cast<double>(t.c))};
+        ASSERT_EQ(oriented, direct);
+        ASSERT_EQ(std::signbit(oriented.x1), std::signbit(direct.x1));
+        ASSERT_EQ(std::signbit(oriented.x2), std::signbit(direct.x2));
+    }
+}
+
+TEST(SolutionCacheTest, FindInsert_CountsHitsAndMisses)
+{
+    SolutionCache cache{64};
+    const NormalizedKey key{1, 2, 1};
+    const auto solution{solve(1, 2, 1)};
+
+    EquationSolution found{};
+    ASSERT_FALSE(cache.find(key, found));
+    cache.insert(key, solution);
+    ASSERT_TRUE(cache.find(key, found));
+    ASSERT_EQ(found, solution);
+
+    // inserting an existing key replaces it instead of taking another entry
+    cache.insert(key, solution);
+    ASSERT_TRUE(cache.find(key, found));
+
+    ASSERT_EQ(cache.hits(), 2);
+    ASSERT_EQ(cache.misses(), 1);
+}
+
+TEST(SolutionCacheTest, Insert_BoundedByCapacity)
+{
+    SolutionCache cache{256, 4};
+    ASSERT_EQ(cache.capacity(), 256);
+
+    for (int64_t i = 1; i <= 10000; ++i)
+    {
+        cache.insert({1, i, 0}, solve(1, static_cast<double>(i), 0));
+    }
+
+    std::size_t cached{0};
+    EquationSolution found{};
+    for (int64_t i = 1; i <= 10000; ++i)
+    {
+        if (cache.find({1, i, 0}, found))
+        {
+            ASSERT_EQ(found, solve(1, static_cast<double>(i), 0));
+            ++cached;
+        }
+    }
+    ASSERT_LE(cached, cache.capacity());
+    ASSERT_GT(cached, 0);
+}
+
+TEST(SolutionCacheTest, Resolver_SharesProportionalTriplets)
+{
+    SolutionCache cache{1024};
+    DummyQueue queue{};
+
+    std::vector<Triplet> triplets{};
+    for (int64_t i = 0; i < 300; ++i)
+    {
+        const auto k{int64_t{1} << i % 20};
+        const auto sign{i % 2 == 0 ? -1 : 1};
+        triplets.push_back({sign * k, sign * -3 * k, sign * 2 * k, static_cast<int64_t>(triplets.size())});
+        triplets.push_back({0, 2 * k, k, static_cast<int64_t>(triplets.size())});
+    }
+
+    std::vector<EquationSolution> storage(triplets.size());
+    QuadraticEquationResolver<DummyQueue, std::vector<EquationSolution>> resolver(queue, storage, &cache);
+    resolver.resolveBatch(triplets.data(), triplets.size());
+
+    // two distinct normalized keys, only the first kernel block misses, later blocks hit
+    ASSERT_EQ(cache.misses(), SOLVE_BLOCK_SIZE);
+    ASSERT_EQ(cache.hits(), triplets.size() - SOLVE_BLOCK_SIZE);
+    for (std::size_t i = 0; i < triplets.size(); ++i)
+    {
+        const auto& t{triplets[i]};
+        ASSERT_EQ(storage[i], solve(static_cast<double>(t.a), static_cast<double>(t.b), static_cast<double>(t.c)));
+    }
+
+    resolver.resolveBatch(triplets.data(), triplets.size());
+    ASSERT_EQ(cache.misses(), SOLVE_BLOCK_SIZE);
+
+    // printed coefficients stay the original ones, roots keep the order of direct solving
+    ASSERT_EQ(resolver.resolve({-4, 12, -8}), "(-4, 12, -8) => (1, 2), Xmin=1.5");
+    ASSERT_EQ(resolver.resolve({0, 0, 0}), "(0, 0, 0) => infinite roots, no extremum");
+}
+
+TEST(SolutionCacheTest, Resolver_MatchesUncachedBitForBit)
+{
+    // (33, -561, -924) is 33 * (1, -17, -28), the roots of the two round differently
+    std::vector<Triplet> triplets{{1, -17, -28}, {33, -561, -924}};
+    for (const Triplet base : {Triplet{1, -17, -28}, Triplet{7, 3, -11}, Triplet{0, 6, -9}, Triplet{-5, 1, 0},
+                               Triplet{3, 6, 3}, Triplet{2, 1, 9}})
+    {
+        for (const int64_t k : std::initializer_list<int64_t>{1, 3, -3, 4, -6, 1 << 20, 3 << 20, int64_t{1} << 40,
+                                                              int64_t{3} << 40})
+        {
+            triplets.push_back({k * base.a, k * base.b, k * base.c});
+        }
+    }
+    for (std::size_t i = 0; i < triplets.size(); ++i)
+    {
+        triplets[i].id = static_cast<int64_t>(i);
+    }
+
+    SolutionCache cache{1024};
+    DummyQueue queue{};
+    std::vector<EquationSolution> cached(triplets.size());
+    std::vector<EquationSolution> uncached(triplets.size());
+    QuadraticEquationResolver<DummyQueue, std::vector<EquationSolution>> cachedResolver(queue, cached, &cache);
+    QuadraticEquationResolver<DummyQueue, std::vector<EquationSolution>> uncachedResolver(queue, uncached, nullptr);
+
+    // the second pass takes everything from the cache
+    cachedResolver.resolveBatch(triplets.data(), triplets.size());
+    cachedResolver.resolveBatch(triplets.data(), triplets.size());
+    uncachedResolver.resolveBatch(triplets.data(), triplets.size());
+    ASSERT_GT(cache.hits(), 0);
+
+    for (std::size_t i = 0; i < triplets.size(); ++i)
+    {
+        ASSERT_EQ(cached[i].kind, uncached[i].kind) << i;
+        ASSERT_EQ(std::memcmp(&cached[i].x1, &uncached[i].x1, sizeof(double)), 0) << i;
+        ASSERT_EQ(std::memcmp(&cached[i].x2, &uncached[i].x2, sizeof(double)), 0) << i;
+        ASSERT_EQ(std::memcmp(&cached[i].xMin, &uncached[i].xMin, sizeof(double)), 0) << i;
+    }
+}
+
+TEST(SolutionCacheTest, ConcurrentResolvers)
+{
+    static constexpr int64_t COUNT{20000};
+
+    SolutionCache cache{512, 8};
+    DummyQueue queue{};
+
+    std::vector<Triplet> triplets{};
+    for (int64_t i = 0; i < COUNT; ++i)
+    {
+        const auto k{i % 7 + 1};
+        triplets.push_back({k * (i % 5 - 2), k * (i % 9 - 4), k * (i % 3 - 1), i});
+    }
+
+    std::vector<EquationSolution> storage(COUNT);
+    std::vector<std::thread> threads{};
+    for (int64_t part = 0; part < 4; ++part)
+    {
+        threads.emplace_back([&, part]
+        {
+            QuadraticEquationResolver<DummyQueue, std::vector<EquationSolution>> resolver(queue, storage, &cache);
+            resolver.resolveBatch(triplets.data() + part * COUNT / 4, COUNT / 4);
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const auto& t : triplets)
+    {
+        const auto key{normalize(t)};
+        ASSERT_EQ(storage[t.id], orient(t, key, solve(static_cast<double>(key.a), static_cast<double>(key.b),
+                                                      static_cast<double>(key.c))));
+    }
+    ASSERT_EQ(cache.hits() + cache.misses(), static_cast<uint64_t>(COUNT));
+}
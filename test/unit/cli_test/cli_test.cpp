@@ -147,3 +147,282 @@ TEST(CliParserTest, ParseCombination_Valid_InvalidInput)
         ASSERT_EQ(args.triplets, testCase.expected.triplets);
     }
 }
+
+TEST(CliParserTest, ParseInputOption)
+{
+    CliParser cli{};
+    CliArgs args{};
+
+    // file and stdin sources
+    for (const char* path : {"input.txt", "-"})
+    {
+        std::vector<const char*> argv{"app_name", "--input", path};
+        ASSERT_NO_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()));
+        ASSERT_EQ(args.inputPath, path);
+        ASSERT_TRUE(args.triplets.empty());
+    }
+
+    // missing option value
+    {
+        std::vector<const char*> argv{"app_name", "--input"};
+        ASSERT_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()), std::invalid_argument);
+    }
+
+    // streaming source can't be mixed with command line coefficients
+    {
+        std::vector<const char*> argv{"app_name", "1", "2", "3", "--input", "-"};
+        ASSERT_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()), std::invalid_argument);
+    }
+}
+
+TEST(CliParserTest, ParseInputFormatOption)
+{
+    CliParser cli{};
+    CliArgs args{};
+
+    {
+        std::vector<const char*> argv{"app_name", "--input", "-"};
+        ASSERT_NO_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()));
+        ASSERT_EQ(args.inputFormat, InputFormat::Text);
+    }
+
+    {
+        std::vector<const char*> argv{"app_name", "--input-format", "binary", "--input", "input.bin"};
+        ASSERT_NO_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()));
+        ASSERT_EQ(args.inputFormat, InputFormat::Binary);
+        ASSERT_EQ(args.inputPath, "input.bin");
+    }
+
+    // unknown format, binary stdin and binary without input file
+    std::vector<std::vector<const char*>> invalidCases{
+        {"app_name", "--input", "input.bin", "--input-format", "json"},
+        {"app_name", "--input", "-", "--input-format", "binary"},
+        {"app_name", "1", "2", "3", "--input-format", "binary"},
+        {"app_name", "--input", "input.bin", "--input-format"},
+    };
+    for (auto& argv : invalidCases)
+    {
+        ASSERT_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()), std::invalid_argument);
+    }
+}
+
+TEST(CliParserTest, ParseQueueOption)
+{
+    CliParser cli{};
+    CliArgs args{};
+
+    {
+        std::vector<const char*> argv{"app_name", "1", "2", "3"};
+        ASSERT_NO_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()));
+        ASSERT_EQ(args.queueKind, QueueKind::Blocking);
+    }
+
+    {
+        std::vector<const char*> argv{"app_name", "--queue", "lockfree", "1", "2", "3"};
+        ASSERT_NO_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()));
+        ASSERT_EQ(args.queueKind, QueueKind::LockFree);
+        ASSERT_EQ(args.triplets, (std::vector<Triplet>{{1, 2, 3}}));
+    }
+
+    {
+        std::vector<const char*> argv{"app_name", "--queue", "stealing", "--input", "-"};
+        ASSERT_NO_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()));
+        ASSERT_EQ(args.queueKind, QueueKind::WorkStealing);
+    }
+
+    {
+        std::vector<const char*> argv{"app_name", "--queue", "ring", "1", "2", "3"};
+        ASSERT_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()), std::invalid_argument);
+    }
+}
+
+TEST(CliParserTest, ParseCacheOption)
+{
+    CliParser cli{};
+    CliArgs args{};
+
+    {
+        std::vector<const char*> argv{"app_name", "1", "2", "3"};
+        ASSERT_NO_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()));
+        ASSERT_EQ(args.cacheSize, 0);
+    }
+
+    {
+        std::vector<const char*> argv{"app_name", "1", "2", "3", "--cache", "4096"};
+        ASSERT_NO_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()));
+        ASSERT_EQ(args.cacheSize, 4096);
+        ASSERT_EQ(args.triplets, (std::vector<Triplet>{{1, 2, 3}}));
+    }
+
+    for (const char* size : {"", "-1", "12k"})
+    {
+        std::vector<const char*> argv{"app_name", "--cache", size, "1", "2", "3"};
+        ASSERT_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()), std::invalid_argument);
+    }
+}
+
+TEST(CliParserTest, ParseThreadOptions)
+{
+    CliParser cli{};
+    CliArgs args{};
+
+    {
+        std::vector<const char*> argv{"app_name", "--threads", "6", "--cpus", "0-2,8", "1", "2", "3"};
+        ASSERT_NO_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()));
+        ASSERT_EQ(args.threadCount, 6);
+        ASSERT_EQ(args.cpus, (std::vector<int>{0, 1, 2, 8}));
+        ASSERT_EQ(args.triplets, (std::vector<Triplet>{{1, 2, 3}}));
+    }
+
+    for (const char* count : {"", "0", "-1", "2x"})
+    {
+        std::vector<const char*> argv{"app_name", "--threads", count, "1", "2", "3"};
+        ASSERT_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()), std::invalid_argument);
+    }
+
+    for (const char* cpus : {"", "3-1", "0x0"})
+    {
+        std::vector<const char*> argv{"app_name", "--cpus", cpus, "1", "2", "3"};
+        ASSERT_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()), std::invalid_argument);
+    }
+}
+
+TEST(CliParserTest, ParseServeOption)
+{
+    CliParser cli{};
+    CliArgs args{};
+
+    {
+        std::vector<const char*> argv{"app_name", "--serve", "/tmp/solver.sock", "--threads", "2"};
+        ASSERT_NO_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()));
+        ASSERT_EQ(args.socketPath, "/tmp/solver.sock");
+        ASSERT_TRUE(args.triplets.empty());
+    }
+
+    {
+        std::vector<const char*> argv{"app_name", "--serve", "/tmp/solver.sock", "1", "2", "3"};
+        ASSERT_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()), std::invalid_argument);
+    }
+
+    {
+        std::vector<const char*> argv{"app_name", "--serve", "/tmp/solver.sock", "--input", "-"};
+        ASSERT_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()), std::invalid_argument);
+    }
+}
+
+TEST(CliParserTest, ParsePlannerOptions)
+{
+    CliParser cli{};
+    CliArgs args{};
+
+    {
+        std::vector<const char*> argv{"app_name", "--plan", "serial", "--planner-config", "/tmp/planner.conf", "1", "2", "3"};
+        ASSERT_NO_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()));
+        ASSERT_EQ(args.executionMode, ExecutionMode::Serial);
+        ASSERT_EQ(args.plannerConfigPath, "/tmp/planner.conf");
+        ASSERT_FALSE(args.calibrate);
+        ASSERT_EQ(args.triplets, (std::vector<Triplet>{{1, 2, 3}}));
+    }
+
+    {
+        std::vector<const char*> argv{"app_name", "--plan", "parallel", "--input", "-"};
+        ASSERT_NO_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()));
+        ASSERT_EQ(args.executionMode, ExecutionMode::Parallel);
+    }
+
+    {
+        std::vector<const char*> argv{"app_name", "--calibrate", "--threads", "4"};
+        ASSERT_NO_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()));
+        ASSERT_TRUE(args.calibrate);
+        ASSERT_EQ(args.executionMode, ExecutionMode::Auto);
+        ASSERT_TRUE(args.triplets.empty());
+    }
+
+    {
+        std::vector<const char*> argv{"app_name", "--aggregate", "--input", "-"};
+        ASSERT_NO_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()));
+        ASSERT_TRUE(args.aggregate);
+    }
+
+    for (std::vector<const char*> argv : {std::vector<const char*>{"app_name", "--plan", "chunked", "1", "2", "3"},
+                                          std::vector<const char*>{"app_name", "--aggregate", "--output-format", "binary",
+                                                                   "--output", "/tmp/results.bin", "1", "2", "3"},
+                                          std::vector<const char*>{"app_name", "--aggregate", "--serve", "/tmp/s.sock"},
+                                          std::vector<const char*>{"app_name", "--calibrate", "1", "2", "3"},
+                                          std::vector<const char*>{"app_name", "--calibrate", "--input", "-"}})
+    {
+        ASSERT_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()), std::invalid_argument);
+    }
+}
+
+TEST(CliParserTest, ParseOutputOptions)
+{
+    CliParser cli{};
+    CliArgs args{};
+
+    {
+        std::vector<const char*> argv{"app_name", "1", "x", "2", "3", "4", "5", "6", "y", "z"};
+        ASSERT_NO_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()));
+        ASSERT_EQ(args.outputFormat, OutputFormat::Text);
+        ASSERT_TRUE(args.outputPath.empty());
+
+        // rejected triplets are placed in front of the next valid id
+        ASSERT_EQ(args.triplets.size(), 1);
+        ASSERT_EQ(args.rejected, (std::vector<int64_t>{0, 1}));
+    }
+
+    {
+        std::vector<const char*> argv{"app_name", "--output-format", "binary", "--output", "out.bin", "1", "2", "3"};
+        ASSERT_NO_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()));
+        ASSERT_EQ(args.outputFormat, OutputFormat::Binary);
+        ASSERT_EQ(args.outputPath, "out.bin");
+    }
+
+    {
+        std::vector<const char*> argv{"app_name", "--output-format", "binary", "1", "2", "3"};
+        ASSERT_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()), std::invalid_argument);
+    }
+
+    {
+        std::vector<const char*> argv{"app_name", "--output-format", "binary", "--output", "-", "1", "2", "3"};
+        ASSERT_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()), std::invalid_argument);
+    }
+
+    {
+        std::vector<const char*> argv{"app_name", "--output-format", "json", "1", "2", "3"};
+        ASSERT_THROW(args = cli.parse(static_cast<int>(argv.size()), argv.data()), std::invalid_argument);
+    }
+}
+
+TEST(CliParserTest, ParseParallelParts_MatchSerialParsing)
+{
+    // several parts worth of arguments with garbage and a trailing incomplete triplet
+    std::vector<std::string> tokens{"app_name"};
+    for (int32_t i = 0; i < 3 * 3 * CliParser::MIN_PART_TRIPLETS + 2; ++i)
+    {
+        tokens.emplace_back(i % 1009 == 0 ? "x" : std::to_string(i % 201 - 100));
+    }
+    std::vector<const char*> argv{};
+    for (const auto& token : tokens)
+    {
+        argv.push_back(token.c_str());
+    }
+    const auto argc{static_cast<int>(argv.size())};
+
+    testing::internal::CaptureStdout();
+    const auto expected{CliParser{}.parse(argc, argv.data())};
+    const auto expectedDiagnostics{testing::internal::GetCapturedStdout()};
+
+    for (uint32_t threads : {2u, 3u, 8u})
+    {
+        testing::internal::CaptureStdout();
+        const auto actual{CliParser{threads}.parse(argc, argv.data())};
+        ASSERT_EQ(testing::internal::GetCapturedStdout(), expectedDiagnostics);
+
+        ASSERT_EQ(actual.triplets, expected.triplets);
+        for (std::size_t i = 0; i < actual.triplets.size(); ++i)
+        {
+            ASSERT_EQ(actual.triplets[i].id, static_cast<int64_t>(i));
+        }
+    }
+}
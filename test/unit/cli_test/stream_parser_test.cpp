@@ -0,0 +1,173 @@
+#include "cli/stream_parser.h"
+
+#include <gtest/gtest.h>
+#include <sstream>
+
+using namespace testing;
+using namespace tektask::cli_parser;
+using namespace tektask::utils::types;
+
+struct StreamParserTestCase
+{
+    std::string input{};
+    std::vector<Triplet> expected{};
+};
+
+namespace
+{
+    std::vector<Triplet> parseAll(const std::string& input, std::size_t chunkSize)
+    {
+        std::istringstream stream{input};
+        StreamParser parser{stream, chunkSize};
+
+        std::vector<Triplet> actual{};
+        std::vector<Triplet> chunk{};
+        while (parser.next(chunk))
+        {
+            actual.insert(actual.end(), chunk.begin(), chunk.end());
+        }
+        return actual;
+    }
+}
+
+
+TEST(StreamParserTest, ParseEmptyInput)
+{
+    for (const std::string input : {"", " ", "\n\n\t "})
+    {
+        std::istringstream stream{input};
+        StreamParser parser{stream};
+
+        std::vector<Triplet> chunk{};
+        ASSERT_FALSE(parser.next(chunk));
+        ASSERT_TRUE(chunk.empty());
+        ASSERT_EQ(parser.parsedCount(), 0);
+    }
+}
+
+TEST(StreamParserTest, ParseValidAndInvalidInput)
+{
+    std::vector<StreamParserTestCase> cases{
+        // single triplet, different separators
+        {"0 1 2", {{0, 1, 2}}},
+        {"-1\n-2\n-3\n", {{-1, -2, -3}}},
+        {"\t10  20\r\n30 ", {{10, 20, 30}}},
+
+        // invalid size
+        {"1 2", {}},
+
+        // garbage and out of range values
+        {"1 a 2 10 20 30", {{10, 20, 30}}},
+        {"1 2 3x 4 5 6 99999999999999999999 1 1", {{4, 5, 6}}},
+
+        // skip second triplet, skip last triplet (invalid size)
+        {"1 2 3\n10 b 30\n-10 -20 -30\na", {{1, 2, 3}, {-10, -20, -30}}},
+    };
+
+    for (const auto& testCase : cases)
+    {
+        ASSERT_EQ(parseAll(testCase.input, StreamParser::DEFAULT_CHUNK_SIZE), testCase.expected);
+    }
+}
+
+TEST(StreamParserTest, ParseAcrossChunkBoundaries)
+{
+    std::string input{};
+    std::vector<Triplet> expected{};
+    for (int64_t i = 0; i < 1000; ++i)
+    {
+        input += std::to_string(i) + " " + std::to_string(-i * 1000) + "\n" + std::to_string(i * 7) + "\n";
+        expected.push_back({i, -i * 1000, i * 7});
+    }
+
+    // tiny chunks split tokens and triplets, buffer has to grow to fit a whole triplet
+    for (std::size_t chunkSize : {1, 2, 3, 7, 64, 4096})
+    {
+        std::istringstream stream{input};
+        StreamParser parser{stream, chunkSize};
+
+        std::vector<Triplet> actual{};
+        std::vector<Triplet> chunk{};
+        while (parser.next(chunk))
+        {
+            for (const auto& triplet : chunk)
+            {
+                // ids follow input order
+                ASSERT_EQ(triplet.id, static_cast<int64_t>(actual.size()));
+                actual.emplace_back(triplet);
+            }
+        }
+
+        ASSERT_EQ(actual, expected);
+        ASSERT_EQ(parser.parsedCount(), expected.size());
+    }
+}
+
+TEST(StreamParserTest, RejectedPositions_AcrossChunks)
+{
+    for (const std::size_t chunkSize : {4, 16, 1024})
+    {
+        std::istringstream stream{"1 x 2 3 4 5 6 y z 7 8 9 q w e"};
+        StreamParser parser{stream, chunkSize};
+
+        std::vector<int64_t> rejected{};
+        std::vector<Triplet> chunk{};
+        bool more{true};
+        while (more)
+        {
+            more = parser.next(chunk);
+            rejected.insert(rejected.end(), parser.rejected().begin(), parser.rejected().end());
+        }
+
+        // each rejected triplet is placed in front of the next valid id
+        ASSERT_EQ(rejected, (std::vector<int64_t>{0, 1, 2})) << "chunk size " << chunkSize;
+        ASSERT_EQ(parser.parsedCount(), 2);
+    }
+}
+
+TEST(StreamParserTest, ParallelParts_MatchSerialParsing)
+{
+    // tokens of varying length with garbage and an incomplete trailing triplet, so parts split triplets anywhere
+    std::string input{};
+    for (int64_t i = 0; i < 50001; ++i)
+    {
+        input += std::to_string(i * 37 % 1001 - 500);
+        input += i % 997 == 0 ? "x" : "";
+        input += i % 11 == 0 ? "\n" : "  ";
+    }
+    input += "1 2";
+
+    auto parseWith = [&input](std::size_t chunkSize, uint32_t threads, std::string& diagnostics)
+    {
+        std::istringstream stream{input};
+        StreamParser parser{stream, chunkSize, threads};
+
+        testing::internal::CaptureStdout();
+        std::vector<Triplet> actual{};
+        std::vector<Triplet> chunk{};
+        while (parser.next(chunk))
+        {
+            for (const auto& triplet : chunk)
+            {
+                EXPECT_EQ(triplet.id, static_cast<int64_t>(actual.size()));
+                actual.emplace_back(triplet);
+            }
+        }
+        diagnostics = testing::internal::GetCapturedStdout();
+        return actual;
+    };
+
+    std::string expectedDiagnostics{};
+    const auto expected{parseWith(StreamParser::DEFAULT_CHUNK_SIZE, 1, expectedDiagnostics)};
+    ASSERT_NE(expectedDiagnostics.find("(1,2,) => "), std::string::npos);
+
+    for (uint32_t threads : {2u, 3u, 8u})
+    {
+        for (std::size_t chunkSize : {StreamParser::MIN_PART_SIZE, 3 * StreamParser::MIN_PART_SIZE + 5})
+        {
+            std::string diagnostics{};
+            ASSERT_EQ(parseWith(chunkSize, threads, diagnostics), expected);
+            ASSERT_EQ(diagnostics, expectedDiagnostics);
+        }
+    }
+}
@@ -0,0 +1,106 @@
+#include "cli/token_scanner.h"
+
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace testing;
+using namespace tektask::cli_parser;
+
+namespace
+{
+    std::vector<std::string_view> scanAll(const std::string& text, std::size_t pos, std::size_t limit)
+    {
+        TokenScanner scanner{text.data(), pos, limit};
+        std::vector<std::string_view> tokens{};
+        for (auto token{scanner.next()}; !token.empty(); token = scanner.next())
+        {
+            tokens.push_back(token);
+        }
+        EXPECT_EQ(scanner.position(), limit);
+        return tokens;
+    }
+
+    std::vector<std::string_view> splitReference(const std::string& text, std::size_t pos, std::size_t limit)
+    {
+        std::vector<std::string_view> tokens{};
+        while (pos < limit)
+        {
+            while (pos < limit && isSpace(text[pos]))
+            {
+                ++pos;
+            }
+            const auto begin{pos};
+            while (pos < limit && !isSpace(text[pos]))
+            {
+                ++pos;
+            }
+            if (pos > begin)
+            {
+                tokens.emplace_back(text.data() + begin, pos - begin);
+            }
+        }
+        return tokens;
+    }
+}
+
+
+TEST(TokenScannerTest, WhitespaceMask_AllSeparators)
+{
+    std::string block(TokenScanner::BLOCK_SIZE, 'x');
+    block[0] = ' ';
+    block[9] = '\t';
+    block[10] = '\n';
+    block[11] = '\v';
+    block[12] = '\f';
+    block[13] = '\r';
+    block[63] = ' ';
+
+    // neighbours of the control range are not whitespace
+    block[20] = '\x08';
+    block[21] = '\x0e';
+    block[22] = '\x80';
+    block[23] = '\0';
+
+    const auto expected{(uint64_t{1} << 0) | (uint64_t{0x1F} << 9) | (uint64_t{1} << 63)};
+    ASSERT_EQ(whitespaceMask(block.data()), expected);
+}
+
+TEST(TokenScannerTest, Next_SplitsTokens)
+{
+    const std::string text{"  12 -3\t\t4x\n\r\n5"};
+    ASSERT_EQ(scanAll(text, 0, text.size()), (std::vector<std::string_view>{"12", "-3", "4x", "5"}));
+
+    // limit cuts the last token, starting position may be inside a block
+    ASSERT_EQ(scanAll(text, 3, 10), (std::vector<std::string_view>{"2", "-3", "4"}));
+    ASSERT_TRUE(scanAll(text, 0, 0).empty());
+    ASSERT_TRUE(scanAll("   \n ", 0, 5).empty());
+}
+
+TEST(TokenScannerTest, Next_MatchesScalarSplitAcrossBlocks)
+{
+    // long tokens and long gaps straddle block bounds
+    std::mt19937 engine{42};
+    std::uniform_int_distribution<int> length{0, 150};
+    std::uniform_int_distribution<int> kind{0, 7};
+    std::string text{};
+    for (int i = 0; i < 2000; ++i)
+    {
+        const auto size{length(engine)};
+        const char separators[]{' ', '\n', '\t', '\r', '\v', '\f'};
+        for (int j = 0; j < size; ++j)
+        {
+            const auto k{kind(engine)};
+            text += k < 6 && i % 2 ? separators[k] : static_cast<char>('0' + k);
+        }
+    }
+
+    for (const std::size_t pos : {0, 1, 63, 64, 65, 1000})
+    {
+        for (const auto limit : {text.size(), text.size() - 1, text.size() - 64, std::size_t{4097}})
+        {
+            ASSERT_EQ(scanAll(text, pos, limit), splitReference(text, pos, limit)) << pos << " " << limit;
+        }
+    }
+}
@@ -0,0 +1,86 @@
+#include "cli/triplet_tokens.h"
+
+#include <gtest/gtest.h>
+#include <charconv>
+#include <random>
+#include <string>
+
+using namespace testing;
+using namespace tektask::cli_parser;
+
+namespace
+{
+    bool parseReference(std::string_view token, int64_t& out)
+    {
+        const char* end{token.data() + token.size()};
+        const auto result{std::from_chars(token.data(), end, out)};
+        return !token.empty() && result.ec == std::errc{} && result.ptr == end;
+    }
+
+    void expectSameAsReference(const std::string& token)
+    {
+        int64_t expected{-7};
+        int64_t actual{-7};
+        int64_t actualTerminated{-7};
+        const auto valid{parseReference(token, expected)};
+        ASSERT_EQ(parseCoefficient(std::string_view{token}, actual), valid) << "token '" << token << "'";
+        ASSERT_EQ(parseCoefficient(token.c_str(), actualTerminated), valid) << "token '" << token << "'";
+        if (valid)
+        {
+            ASSERT_EQ(actual, expected) << "token '" << token << "'";
+            ASSERT_EQ(actualTerminated, expected) << "token '" << token << "'";
+        }
+    }
+}
+
+
+TEST(TripletTokensTest, ParseCoefficient_Bounds)
+{
+    for (const std::string token : {
+             "0", "-0", "7", "-7", "00000000", "12345678", "-12345678", "123456789",
+             "9223372036854775807", "-9223372036854775808",
+             "9223372036854775808", "-9223372036854775809", "9999999999999999999", "-9999999999999999999",
+             "18446744073709551616", "99999999999999999999", "00000000000000000000000000042",
+             "-0000000000000000000009223372036854775808", "0000000000000000000009223372036854775808",
+         })
+    {
+        expectSameAsReference(token);
+    }
+}
+
+TEST(TripletTokensTest, ParseCoefficient_Garbage)
+{
+    for (const std::string token : {
+             "", "-", "--1", "+1", "1-", "12x", "x12", "1234567x", "12345678x", "1234567890123456x",
+             "1.5", "1e3", "0x10", " 1", "1 ", "١", "123456789012345678901234567890x", "/", ":",
+             "12345678/", "1234567:",
+         })
+    {
+        expectSameAsReference(token);
+    }
+}
+
+TEST(TripletTokensTest, ParseCoefficient_MatchesFromChars)
+{
+    std::mt19937_64 engine{7};
+    std::uniform_int_distribution<int> length{1, 24};
+    std::uniform_int_distribution<int> character{0, 11};
+
+    for (int i = 0; i < 200000; ++i)
+    {
+        // mostly digits, sometimes a sign or a neighbour of the digit range
+        std::string token{};
+        const auto size{length(engine)};
+        for (int j = 0; j < size; ++j)
+        {
+            const auto k{character(engine)};
+            token += k < 10 ? static_cast<char>('0' + k) : k == 10 ? '-' : (j % 2 ? '/' : ':');
+        }
+        if (i % 3 == 0)
+        {
+            // valid numbers of every length, near int64 bounds included
+            token = std::to_string(static_cast<int64_t>(engine()) >> (i % 64));
+        }
+        expectSameAsReference(token);
+    }
+}
@@ -0,0 +1,120 @@
+#include "io/binary_results.h"
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <filesystem>
+#include <limits>
+
+using namespace testing;
+using namespace tektask::io;
+using namespace tektask::utils::types;
+
+namespace
+{
+    std::string tempPath(const std::string& name)
+    {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+}
+
+
+TEST(BinaryResultsTest, WriteRead_RoundTrip)
+{
+    const auto path{tempPath("se_solver_binary_results_roundtrip.bin")};
+    const std::vector<Triplet> triplets{
+        {1, -3, 2},
+        {0, 2, -4},
+        {std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min(), -1},
+    };
+    const std::vector<EquationSolution> solutions{
+        {SolveCase::TwoRoots, 1.0, 2.0, 1.5},
+        {SolveCase::Linear, 2.0, 0.0, 0.0},
+        {SolveCase::NoRealRoots, 0.0, 0.0, -0.25},
+    };
+
+    {
+        BinaryResultWriter writer{path};
+        for (std::size_t i = 0; i < triplets.size(); ++i)
+        {
+            writer.write(triplets[i], solutions[i]);
+        }
+        writer.finish();
+        ASSERT_EQ(writer.count(), triplets.size());
+    }
+
+    ASSERT_EQ(std::filesystem::file_size(path),
+              BINARY_RESULTS_HEADER_SIZE + triplets.size() * BINARY_RESULTS_RECORD_SIZE);
+
+    BinaryResultReader reader{path};
+    ASSERT_EQ(reader.size(), triplets.size());
+    ASSERT_EQ(reader.rejectedCount(), 0);
+    for (std::size_t i = 0; i < triplets.size(); ++i)
+    {
+        const auto actual{reader[i]};
+        ASSERT_TRUE(actual.valid);
+        ASSERT_EQ(actual.triplet, triplets[i]);
+        ASSERT_EQ(actual.triplet.id, static_cast<int64_t>(i));
+        ASSERT_EQ(actual.solution, solutions[i]);
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST(BinaryResultsTest, WriteRead_RejectedKeepPositions)
+{
+    const auto path{tempPath("se_solver_binary_results_rejected.bin")};
+    {
+        BinaryResultWriter writer{path};
+        writer.writeRejected();
+        writer.write({1, 2, 1}, {SolveCase::SingleRoot, -1.0, 0.0, -1.0});
+        writer.writeRejected();
+        writer.finish();
+    }
+
+    BinaryResultReader reader{path};
+    ASSERT_EQ(reader.size(), 3);
+    ASSERT_EQ(reader.rejectedCount(), 2);
+
+    ASSERT_FALSE(reader[0].valid);
+    ASSERT_TRUE(reader[1].valid);
+    ASSERT_EQ(reader[1].triplet, (Triplet{1, 2, 1}));
+    ASSERT_EQ(reader[1].solution.kind, SolveCase::SingleRoot);
+    ASSERT_FALSE(reader[2].valid);
+
+    // flags byte of a solved record
+    MappedFile file{path};
+    const auto* records{reinterpret_cast<const unsigned char*>(file.data()) + BINARY_RESULTS_HEADER_SIZE};
+    ASSERT_EQ(records[49], 0x00);
+    ASSERT_EQ(records[BINARY_RESULTS_RECORD_SIZE + 48], static_cast<unsigned char>(SolveCase::SingleRoot));
+    ASSERT_EQ(records[BINARY_RESULTS_RECORD_SIZE + 49], BINARY_RESULT_VALID);
+
+    std::remove(path.c_str());
+}
+
+TEST(BinaryResultsTest, Read_InvalidFile_ThrowsException)
+{
+    const auto path{tempPath("se_solver_binary_results_invalid.bin")};
+
+    // missing file
+    std::remove(path.c_str());
+    ASSERT_THROW(BinaryResultReader{path}, std::runtime_error);
+
+    // binary triplets are not results
+    {
+        std::ofstream file{path, std::ios::binary};
+        file << "TEKTRPLTand some more text to fill the header";
+    }
+    ASSERT_THROW(BinaryResultReader{path}, std::invalid_argument);
+
+    // truncated records
+    {
+        BinaryResultWriter writer{path};
+        writer.write({1, 2, 3}, {});
+        writer.write({4, 5, 6}, {});
+        writer.finish();
+    }
+    std::filesystem::resize_file(path, BINARY_RESULTS_HEADER_SIZE + BINARY_RESULTS_RECORD_SIZE);
+    ASSERT_THROW(BinaryResultReader{path}, std::invalid_argument);
+
+    std::remove(path.c_str());
+}
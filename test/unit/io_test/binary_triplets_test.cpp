@@ -0,0 +1,108 @@
+#include "io/binary_triplets.h"
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <filesystem>
+#include <limits>
+
+using namespace testing;
+using namespace tektask::io;
+using namespace tektask::utils::types;
+
+namespace
+{
+    std::string tempPath(const std::string& name)
+    {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+}
+
+
+TEST(BinaryTripletsTest, WriteRead_RoundTrip)
+{
+    const auto path{tempPath("se_solver_binary_triplets_roundtrip.bin")};
+    const std::vector<Triplet> expected{
+        {0, 0, 0},
+        {1, -2, -3},
+        {std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min(), -1},
+    };
+
+    {
+        BinaryTripletWriter writer{path};
+        for (const auto& triplet : expected)
+        {
+            writer.write(triplet);
+        }
+        writer.finish();
+        ASSERT_EQ(writer.count(), expected.size());
+    }
+
+    ASSERT_EQ(std::filesystem::file_size(path),
+              BINARY_TRIPLETS_HEADER_SIZE + expected.size() * BINARY_TRIPLETS_RECORD_SIZE);
+
+    BinaryTripletReader reader{path};
+    ASSERT_EQ(reader.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        const auto actual{reader[i]};
+        ASSERT_EQ(actual, expected[i]);
+        ASSERT_EQ(actual.id, static_cast<int64_t>(i));
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST(BinaryTripletsTest, Read_LittleEndianLayout)
+{
+    const auto path{tempPath("se_solver_binary_triplets_layout.bin")};
+    {
+        BinaryTripletWriter writer{path};
+        writer.write({1, -2, 0x0102030405060708});
+        writer.finish();
+    }
+
+    MappedFile file{path};
+    const auto* record{reinterpret_cast<const unsigned char*>(file.data()) + BINARY_TRIPLETS_HEADER_SIZE};
+
+    // a == 1, least significant byte goes first
+    ASSERT_EQ(record[0], 0x01);
+    ASSERT_EQ(record[7], 0x00);
+
+    // b == -2
+    ASSERT_EQ(record[8], 0xFE);
+    ASSERT_EQ(record[15], 0xFF);
+
+    // c == 0x0102030405060708
+    ASSERT_EQ(record[16], 0x08);
+    ASSERT_EQ(record[23], 0x01);
+
+    std::remove(path.c_str());
+}
+
+TEST(BinaryTripletsTest, Read_InvalidFile_ThrowsException)
+{
+    const auto path{tempPath("se_solver_binary_triplets_invalid.bin")};
+
+    // missing file
+    std::remove(path.c_str());
+    ASSERT_THROW(BinaryTripletReader{path}, std::runtime_error);
+
+    // not a binary triplets file
+    {
+        std::ofstream file{path, std::ios::binary};
+        file << "1 -2 -3 and some more text to fill the header";
+    }
+    ASSERT_THROW(BinaryTripletReader{path}, std::invalid_argument);
+
+    // truncated records
+    {
+        BinaryTripletWriter writer{path};
+        writer.write({1, 2, 3});
+        writer.write({4, 5, 6});
+        writer.finish();
+    }
+    std::filesystem::resize_file(path, BINARY_TRIPLETS_HEADER_SIZE + BINARY_TRIPLETS_RECORD_SIZE);
+    ASSERT_THROW(BinaryTripletReader{path}, std::invalid_argument);
+
+    std::remove(path.c_str());
+}
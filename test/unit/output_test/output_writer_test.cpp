@@ -0,0 +1,156 @@
+#include "output/output_writer.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace testing;
+using namespace tektask::output;
+
+namespace
+{
+    /**
+     * @brief Writes numbered lines through every writer entry point, returns the expected text.
+     */
+    std::string writeLines(OutputWriter& out, int lineCount)
+    {
+        std::string expected{};
+        for (int i = 0; i < lineCount; ++i)
+        {
+            const auto line{"line " + std::to_string(i) + " " + std::string(i % 97, 'x') + "\n"};
+            expected += line;
+
+            switch (i % 4)
+            {
+            case 0:
+                line.copy(out.reserve(line.size()), line.size());
+                out.commit(line.size());
+                break;
+            case 1:
+                out.write(line);
+                break;
+            case 2:
+                out.write(std::vector<std::string>{line.substr(0, 3), "", line.substr(3)});
+                break;
+            default:
+                out.write(line);
+                if (i % 1000 == 3)
+                {
+                    out.flush();
+                }
+                break;
+            }
+        }
+        out.flush();
+        return expected;
+    }
+
+    std::string readAll(int fd, std::chrono::microseconds delay = {})
+    {
+        std::string text{};
+        char buffer[4096];
+        ssize_t size{0};
+        while ((size = ::read(fd, buffer, sizeof(buffer))) > 0)
+        {
+            text.append(buffer, size);
+            std::this_thread::sleep_for(delay);
+        }
+        return text;
+    }
+
+#ifdef __linux__
+    /**
+     * @brief Moves the pipe contents on to another pipe with splice(), pages stay referenced by the second one.
+     */
+    void forward(int from, int to)
+    {
+        while (::splice(from, nullptr, to, nullptr, 64 * 1024, SPLICE_F_MOVE) > 0)
+        {
+        }
+        ::close(to);
+    }
+#endif
+}
+
+
+TEST(OutputWriterTest, File_KeepsBytes)
+{
+    std::FILE* file{std::tmpfile()};
+    ASSERT_NE(file, nullptr);
+
+    std::string expected{};
+    {
+        OutputWriter out{::fileno(file), 1000};
+        EXPECT_FALSE(out.splicing());
+        expected = writeLines(out, 20000);
+    }
+
+    const auto fd{::fileno(file)};
+    ::lseek(fd, 0, SEEK_SET);
+    EXPECT_EQ(readAll(fd), expected);
+    std::fclose(file);
+}
+
+TEST(OutputWriterTest, Pipe_KeepsBytes)
+{
+    for (const auto delay : {std::chrono::microseconds{0}, std::chrono::microseconds{20}})
+    {
+        int fds[2];
+        ASSERT_EQ(::pipe(fds), 0);
+
+        std::string received{};
+        std::thread reader{[&received, fd = fds[0], delay] { received = readAll(fd, delay); }};
+
+        std::string expected{};
+        {
+            OutputWriter out{fds[1]};
+#ifdef __linux__
+            EXPECT_TRUE(out.splicing());
+#endif
+            expected = writeLines(out, 100000);
+        }
+        ::close(fds[1]);
+        reader.join();
+        ::close(fds[0]);
+
+        ASSERT_EQ(received.size(), expected.size());
+        EXPECT_TRUE(received == expected);
+    }
+}
+
+#ifdef __linux__
+TEST(OutputWriterTest, Pipe_SplicedFurtherKeepsBytes)
+{
+    int first[2];
+    int second[2];
+    ASSERT_EQ(::pipe(first), 0);
+    ASSERT_EQ(::pipe(second), 0);
+    ::fcntl(second[1], F_SETPIPE_SZ, static_cast<int>(OutputWriter::PIPE_SIZE));
+
+    // pages leave the first pipe long before the slow reader of the second one copies them
+    std::string received{};
+    std::thread forwarder{[from = first[0], to = second[1]] { forward(from, to); }};
+    std::thread reader{[&received, fd = second[0]] { received = readAll(fd, std::chrono::microseconds{20}); }};
+
+    std::string expected{};
+    {
+        OutputWriter out{first[1]};
+        EXPECT_TRUE(out.splicing());
+        expected = writeLines(out, 100000);
+    }
+    ::close(first[1]);
+    forwarder.join();
+    reader.join();
+    ::close(first[0]);
+    ::close(second[0]);
+
+    ASSERT_EQ(received.size(), expected.size());
+    EXPECT_TRUE(received == expected);
+}
+#endif
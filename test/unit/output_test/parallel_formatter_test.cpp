@@ -0,0 +1,106 @@
+#include "output/parallel_formatter.h"
+#include "resolver/quadratic_resolver.h"
+
+#include <gtest/gtest.h>
+
+using namespace testing;
+using namespace tektask::output;
+using namespace tektask::resolver;
+using namespace tektask::utils::types;
+
+namespace
+{
+    class DummyQueue
+    {
+    public:
+        using value_type = Triplet;
+    };
+}
+
+
+TEST(ParallelFormatterTest, FormatRange_AppendsLines)
+{
+    const std::vector<Triplet> triplets{{1, -2, -3}, {0, 0, 0}, {1, 2, 1}};
+    const std::vector<EquationSolution> solutions{
+        solve(1, -2, -3), solve(0, 0, 0), solve(1, 2, 1),
+    };
+
+    std::string out{"head\n"};
+    formatRange(triplets, solutions, 1, 3, out);
+    ASSERT_EQ(out, "head\n(0, 0, 0) => infinite roots, no extremum\n(1, 2, 1) => (-1), Xmin=-1\n");
+}
+
+TEST(ParallelFormatterTest, FormatParallel_MatchesResolveInOrder)
+{
+    static constexpr int64_t COUNT{10007};
+
+    std::vector<Triplet> triplets{};
+    for (int64_t i = 0; i < COUNT; ++i)
+    {
+        triplets.push_back({i % 5 - 2, i % 9 - 4, i % 7 - 3, i});
+    }
+
+    // structured resolver output
+    std::vector<EquationSolution> solutions(COUNT);
+    DummyQueue queue{};
+    QuadraticEquationResolver<DummyQueue, std::vector<EquationSolution>> resolver(queue, solutions);
+    resolver.resolveBatch(triplets.data(), triplets.size());
+
+    std::string expected{};
+    for (const auto& triplet : triplets)
+    {
+        expected += resolver.resolve(triplet) + "\n";
+    }
+
+    for (uint32_t threads : {0u, 1u, 3u, 8u})
+    {
+        std::string actual{};
+        for (const auto& chunk : formatParallel(triplets, solutions, threads))
+        {
+            actual += chunk;
+        }
+        ASSERT_EQ(expected, actual);
+    }
+}
+
+TEST(ParallelFormatterTest, FormatParallel_MoreThreadsThanSolutions)
+{
+    const std::vector<Triplet> triplets{{1, -2, -3}};
+    const std::vector<EquationSolution> solutions{solve(1, -2, -3)};
+
+    const auto chunks{formatParallel(triplets, solutions, 16)};
+    ASSERT_EQ(chunks.size(), 1);
+    ASSERT_EQ(chunks[0], "(1, -2, -3) => (3, -1), Xmin=1\n");
+}
+
+TEST(ParallelFormatterTest, FormatParallel_WindowsMatchWholeRange)
+{
+    static constexpr int64_t COUNT{1000};
+
+    std::vector<Triplet> triplets{};
+    std::vector<EquationSolution> solutions{};
+    for (int64_t i = 0; i < COUNT; ++i)
+    {
+        triplets.push_back({i % 5 - 2, i % 9 - 4, i % 7 - 3, i});
+        solutions.push_back(solve(i % 5 - 2, i % 9 - 4, i % 7 - 3));
+    }
+
+    std::string expected{};
+    formatRange(triplets, solutions, 0, COUNT, expected);
+
+    // chunks are reused and overwritten by every window
+    for (const std::size_t window : {1, 7, 333, 1000})
+    {
+        std::string actual{};
+        std::vector<std::string> chunks{};
+        for (std::size_t first = 0; first < COUNT; first += window)
+        {
+            formatParallel(triplets, solutions, first, std::min<std::size_t>(first + window, COUNT), 3, chunks);
+            for (const auto& chunk : chunks)
+            {
+                actual += chunk;
+            }
+        }
+        ASSERT_EQ(expected, actual) << "window " << window;
+    }
+}
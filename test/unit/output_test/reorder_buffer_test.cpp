@@ -0,0 +1,129 @@
+#include "output/reorder_buffer.h"
+#include "queue/blocking_queue.h"
+#include "resolver/quadratic_resolver.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace testing;
+using namespace tektask::queue;
+using namespace tektask::output;
+using namespace tektask::resolver;
+using namespace tektask::utils::types;
+
+
+TEST(ReorderBufferTest, Window_RoundedUpToPowerOfTwo)
+{
+    ASSERT_EQ(ReorderBuffer{1}.window(), 2);
+    ASSERT_EQ(ReorderBuffer{64}.window(), 64);
+    ASSERT_EQ(ReorderBuffer{100}.window(), 128);
+}
+
+TEST(ReorderBufferTest, Drain_NothingReserved)
+{
+    ReorderBuffer window{8};
+    window.finish();
+
+    std::size_t consumed{0};
+    window.drain([&](const Triplet&, const EquationSolution&) { ++consumed; }, [] {});
+    ASSERT_EQ(consumed, 0);
+}
+
+TEST(ReorderBufferTest, Drain_PublishedOutOfOrder)
+{
+    const std::vector<Triplet> triplets{{1, -2, -3, 0}, {0, 0, 0, 1}, {1, 2, 1, 2}, {0, 2, 1, 3}};
+
+    ReorderBuffer window{8};
+    window.waitReserve(triplets.data(), triplets.size());
+    for (auto id : {2, 0, 3, 1})
+    {
+        const auto& t{triplets[id]};
+        window[id] = solve(static_cast<double>(t.a), static_cast<double>(t.b), static_cast<double>(t.c));
+        window.publish(id);
+    }
+    window.finish();
+
+    std::vector<Triplet> order{};
+    window.drain([&](const Triplet& t, const EquationSolution& solution)
+    {
+        ASSERT_EQ(solution, solve(static_cast<double>(t.a), static_cast<double>(t.b), static_cast<double>(t.c)));
+        order.push_back(t);
+    }, [] {});
+    ASSERT_EQ(order, triplets);
+}
+
+TEST(ReorderBufferTest, Cancel_ReleasesProducerAndWriter)
+{
+    const std::vector<Triplet> triplets{{1, -2, -3, 0}, {0, 0, 0, 1}, {1, 2, 1, 2}};
+
+    // the third id waits for room in a full window, nothing is published
+    ReorderBuffer window{2};
+    ASSERT_TRUE(window.waitReserve(triplets.data(), 2));
+    bool reserved{true};
+    std::thread producer{[&] { reserved = window.waitReserve(triplets.data() + 2, 1); }};
+
+    std::size_t consumed{0};
+    std::thread writer{[&]
+    {
+        window.drain([&](const Triplet&, const EquationSolution&) { ++consumed; }, [] {});
+    }};
+
+    window.cancel();
+    producer.join();
+    writer.join();
+    ASSERT_FALSE(reserved);
+    ASSERT_EQ(consumed, 0);
+    ASSERT_FALSE(window.waitReserve(triplets.data() + 2, 1));
+}
+
+TEST(ReorderBufferTest, Pipeline_SmallWindowKeepsInputOrder)
+{
+    static constexpr int64_t COUNT{100000};
+    static constexpr std::size_t PIECE{16};
+    using Resolver = QuadraticEquationResolver<BlockingQueue<Triplet>, ReorderBuffer>;
+
+    ReorderBuffer window{64};
+    BlockingQueue<Triplet> queue{};
+
+    std::vector<std::thread> resolvers{};
+    for (int i = 0; i < 3; ++i)
+    {
+        resolvers.emplace_back(Resolver(queue, window));
+    }
+
+    int64_t next{0};
+    bool ordered{true};
+    std::thread writer([&]
+    {
+        window.drain([&](const Triplet& t, const EquationSolution& solution)
+        {
+            ordered = ordered && t.id == next && t.a == next % 5 - 2 &&
+                solution == solve(static_cast<double>(t.a), static_cast<double>(t.b), static_cast<double>(t.c));
+            ++next;
+        }, [] {});
+    });
+
+    std::vector<Triplet> piece{};
+    for (int64_t id = 0; id < COUNT; ++id)
+    {
+        piece.push_back({id % 5 - 2, id % 9 - 4, id % 7 - 3, id});
+        if (piece.size() == PIECE || id + 1 == COUNT)
+        {
+            window.waitReserve(piece.data(), piece.size());
+            queue.waitPushBatch(piece.begin(), piece.end());
+            piece.clear();
+        }
+    }
+
+    queue.shutdown();
+    window.finish();
+    for (auto& thread : resolvers)
+    {
+        thread.join();
+    }
+    writer.join();
+
+    ASSERT_TRUE(ordered);
+    ASSERT_EQ(next, COUNT);
+}
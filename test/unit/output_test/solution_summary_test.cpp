@@ -0,0 +1,146 @@
+#include "output/solution_summary.h"
+#include "resolver/quadratic_resolver.h"
+#include "thread/chunked_range.h"
+#include "thread/thread_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <thread>
+#include <sstream>
+#include <stdexcept>
+
+using namespace testing;
+using namespace tektask::output;
+using namespace tektask::thread;
+using namespace tektask::resolver;
+using namespace tektask::utils::types;
+
+
+TEST(SolutionSummaryTest, BucketOf_OrdersOfMagnitude)
+{
+    const auto zero{SolutionSummary::ZERO_BUCKET};
+    ASSERT_EQ(SolutionSummary::bucketOf(0.0), zero);
+    ASSERT_EQ(SolutionSummary::bucketOf(-0.0), zero);
+
+    ASSERT_EQ(SolutionSummary::bucketOf(1.0), SolutionSummary::bucketOf(1.999));
+    ASSERT_EQ(SolutionSummary::bucketOf(2.0), SolutionSummary::bucketOf(1.0) + 1);
+    ASSERT_EQ(SolutionSummary::bucketOf(-1.0), zero - (SolutionSummary::bucketOf(1.0) - zero));
+    ASSERT_LT(SolutionSummary::bucketOf(-4.0), SolutionSummary::bucketOf(-2.0));
+
+    // beyond int64 root magnitudes the edge buckets take everything
+    ASSERT_EQ(SolutionSummary::bucketOf(1e300), SolutionSummary::BUCKET_COUNT - 1);
+    ASSERT_EQ(SolutionSummary::bucketOf(-1e300), 0);
+    ASSERT_EQ(SolutionSummary::bucketOf(1e-300), zero + 1);
+}
+
+TEST(SolutionSummaryTest, Add_CountsCasesExtremaAndRoots)
+{
+    SolutionSummary summary{};
+    ASSERT_FALSE(summary.hasExtremum());
+
+    for (const auto& t : std::vector<Triplet>{{0, 0, 0}, {0, 0, 5}, {0, 2, -4}, {1, 0, 1}, {1, 2, 1}, {1, -2, -3}})
+    {
+        summary.add(solve(double(t.a), double(t.b), double(t.c)));
+    }
+    summary.addRejected(2);
+
+    ASSERT_EQ(summary.equationCount(), 6);
+    ASSERT_EQ(summary.rejectedCount(), 2);
+    for (const auto kind : {SolveCase::InfiniteRoots, SolveCase::NoSolution, SolveCase::Linear,
+                            SolveCase::NoRealRoots, SolveCase::SingleRoot, SolveCase::TwoRoots})
+    {
+        ASSERT_EQ(summary.count(kind), 1);
+    }
+
+    ASSERT_TRUE(summary.hasExtremum());
+    ASSERT_EQ(summary.minXmin(), -1.0);
+    ASSERT_EQ(summary.maxXmin(), 1.0);
+
+    // roots 2, -1, 3 and -1
+    ASSERT_EQ(summary.bucket(SolutionSummary::bucketOf(-1.0)), 2);
+    ASSERT_EQ(summary.bucket(SolutionSummary::bucketOf(2.0)), 2);
+
+    std::ostringstream text{};
+    printSummary(summary, text);
+    ASSERT_EQ(text.str(), "equations: 6\n"
+                          "rejected: 2\n"
+                          "infinite roots: 1\n"
+                          "no solution: 1\n"
+                          "linear: 1\n"
+                          "no real roots: 1\n"
+                          "single root: 1\n"
+                          "two roots: 1\n"
+                          "Xmin: [-1, 1]\n"
+                          "roots: 4\n"
+                          "  (-2, -1]: 2\n"
+                          "  [2, 4): 2\n");
+}
+
+TEST(SolutionSummaryTest, ShardedSummary_ReductionMatchesSingleSummary)
+{
+    std::mt19937_64 engine{5};
+    std::uniform_int_distribution<int64_t> coefficient{-1000, 1000};
+    std::vector<Triplet> triplets(100'000);
+    for (std::size_t i = 0; i < triplets.size(); ++i)
+    {
+        triplets[i] = {coefficient(engine), coefficient(engine), coefficient(engine), static_cast<int64_t>(i)};
+    }
+
+    SolutionSummary expected{};
+    for (const auto& t : triplets)
+    {
+        expected.add(solve(double(t.a), double(t.b), double(t.c)));
+    }
+
+    // uneven worker count leaves a partner missing in some rounds
+    constexpr std::size_t WORKERS{5};
+    ChunkedRange<Triplet> input{triplets.data(), triplets.size(), WORKERS, SOLVE_BLOCK_SIZE};
+    ShardedSummary summaries{WORKERS};
+    std::vector<std::thread> workers{};
+    for (std::size_t worker = 0; worker < WORKERS; ++worker)
+    {
+        workers.emplace_back([&, worker]
+        {
+            QuadraticEquationResolver<ChunkedRange<Triplet>, SolutionSummary> resolver{input, summaries.shard(worker)};
+            resolver();
+            summaries.reduce(worker);
+        });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    const auto& total{summaries.total()};
+    ASSERT_EQ(total.equationCount(), triplets.size());
+    for (std::size_t kind = 0; kind < SolutionSummary::CASE_COUNT; ++kind)
+    {
+        ASSERT_EQ(total.count(static_cast<SolveCase>(kind)), expected.count(static_cast<SolveCase>(kind)));
+    }
+    for (std::size_t bucket = 0; bucket < SolutionSummary::BUCKET_COUNT; ++bucket)
+    {
+        ASSERT_EQ(total.bucket(bucket), expected.bucket(bucket));
+    }
+    ASSERT_EQ(total.minXmin(), expected.minXmin());
+    ASSERT_EQ(total.maxXmin(), expected.maxXmin());
+}
+
+TEST(SolutionSummaryTest, ShardedSummary_FailedWorkerStillReduces)
+{
+    // worker 2 merges the shard of worker 3, it must not wait for the failed one forever
+    constexpr uint32_t WORKERS{4};
+    ShardedSummary summaries{WORKERS};
+    ThreadPool pool{WORKERS};
+    pool.start([&summaries](uint32_t worker)
+    {
+        ShardedSummary::ReduceGuard reducing{summaries, worker};
+        summaries.shard(worker).add(solve(1.0, -3.0, 2.0));
+        if (worker == WORKERS - 1)
+        {
+            throw std::runtime_error("failed");
+        }
+    });
+    ASSERT_THROW(pool.wait(), std::runtime_error);
+    ASSERT_EQ(summaries.total().equationCount(), WORKERS);
+}
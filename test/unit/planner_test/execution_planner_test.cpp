@@ -0,0 +1,139 @@
+#include "planner/calibration.h"
+#include "planner/execution_planner.h"
+#include "io/binary_triplets.h"
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <filesystem>
+
+using namespace testing;
+using namespace tektask::io;
+using namespace tektask::planner;
+using namespace tektask::utils::types;
+
+namespace
+{
+    std::string tempPath(const std::string& name)
+    {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    JobSize textJob(std::size_t bytes)
+    {
+        return {0, bytes, true, false};
+    }
+}
+
+
+TEST(ExecutionPlannerTest, Plan_BySizeAndSource)
+{
+    const ExecutionPlanner planner{{100, 1000}, 8};
+
+    ASSERT_EQ(planner.plan({1, 0, false, false}), ExecutionPlan::Serial);
+    ASSERT_EQ(planner.plan({100, 0, false, false}), ExecutionPlan::Serial);
+    ASSERT_EQ(planner.plan({101, 0, false, false}), ExecutionPlan::Chunked);
+
+    ASSERT_EQ(planner.plan(textJob(1000)), ExecutionPlan::Serial);
+    ASSERT_EQ(planner.plan(textJob(1001)), ExecutionPlan::Streaming);
+    // a pipe is streamed whatever it turns out to hold
+    ASSERT_EQ(planner.plan({0, 0, true, true}), ExecutionPlan::Streaming);
+}
+
+TEST(ExecutionPlannerTest, Plan_ForcedModesAndLimits)
+{
+    const ExecutionPlanner planner{{100, 1000}, 8};
+    ASSERT_EQ(planner.plan({1'000'000, 0, false, false}, ExecutionMode::Serial), ExecutionPlan::Serial);
+    ASSERT_EQ(planner.plan({0, 0, true, true}, ExecutionMode::Serial), ExecutionPlan::Serial);
+    ASSERT_EQ(planner.plan({1, 0, false, false}, ExecutionMode::Parallel), ExecutionPlan::Chunked);
+    ASSERT_EQ(planner.plan(textJob(1), ExecutionMode::Parallel), ExecutionPlan::Streaming);
+
+    // a single thread solves in-memory input serially, text beyond a parser chunk is still streamed
+    const ExecutionPlanner single{{100, PlannerConfig::MAX_SERIAL_BYTES * 4}, 1};
+    ASSERT_EQ(single.plan({1'000'000, 0, false, false}), ExecutionPlan::Serial);
+    ASSERT_EQ(single.plan(textJob(PlannerConfig::MAX_SERIAL_BYTES)), ExecutionPlan::Serial);
+    ASSERT_EQ(single.plan(textJob(PlannerConfig::MAX_SERIAL_BYTES + 1)), ExecutionPlan::Streaming);
+}
+
+TEST(ExecutionPlannerTest, MeasureJob_Sources)
+{
+    CliArgs args{};
+    args.triplets = {{1, 2, 3}, {4, 5, 6}};
+    ASSERT_EQ(measureJob(args).triplets, 2);
+    ASSERT_FALSE(measureJob(args).text);
+
+    const auto textPath{tempPath("se_solver_planner_job.txt")};
+    std::ofstream{textPath} << "1 -2 -3\n";
+    args = CliArgs{};
+    args.inputPath = textPath;
+    auto job{measureJob(args)};
+    ASSERT_TRUE(job.text);
+    ASSERT_FALSE(job.unbounded);
+    ASSERT_EQ(job.bytes, 8);
+
+    const auto binaryPath{tempPath("se_solver_planner_job.bin")};
+    {
+        BinaryTripletWriter writer{binaryPath};
+        writer.write({1, -2, -3});
+        writer.write({1, 2, 1});
+        writer.finish();
+    }
+    args.inputPath = binaryPath;
+    args.inputFormat = InputFormat::Binary;
+    job = measureJob(args);
+    ASSERT_FALSE(job.text);
+    ASSERT_EQ(job.triplets, 2);
+
+    std::remove(textPath.c_str());
+    std::remove(binaryPath.c_str());
+}
+
+TEST(ExecutionPlannerTest, PlannerConfig_SaveLoad)
+{
+    const auto directory{tempPath("se_solver_planner_config")};
+    const auto path{directory + "/nested/planner.conf"};
+    std::filesystem::remove_all(directory);
+
+    // missing file keeps the defaults
+    const auto defaults{PlannerConfig::load(path)};
+    ASSERT_EQ(defaults.serialMaxTriplets, PlannerConfig::DEFAULT_SERIAL_MAX_TRIPLETS);
+    ASSERT_EQ(defaults.serialMaxBytes, PlannerConfig::DEFAULT_SERIAL_MAX_BYTES);
+
+    PlannerConfig{1234, 5678}.save(path);
+    const auto loaded{PlannerConfig::load(path)};
+    ASSERT_EQ(loaded.serialMaxTriplets, 1234);
+    ASSERT_EQ(loaded.serialMaxBytes, 5678);
+
+    // comments, blanks and unknown keys are skipped, missing keys keep the defaults
+    std::ofstream{path} << "# thresholds\n\n  serial_max_bytes = 42  # inline\nfuture_key=7\n";
+    const auto partial{PlannerConfig::load(path)};
+    ASSERT_EQ(partial.serialMaxTriplets, PlannerConfig::DEFAULT_SERIAL_MAX_TRIPLETS);
+    ASSERT_EQ(partial.serialMaxBytes, 42);
+
+    for (const char* line : {"serial_max_bytes\n", "serial_max_bytes=\n", "serial_max_bytes=-1\n", "serial_max_bytes=1x\n"})
+    {
+        std::ofstream{path} << line;
+        ASSERT_THROW(static_cast<void>(PlannerConfig::load(path)), std::invalid_argument) << line;
+    }
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST(ExecutionPlannerTest, Thresholds_BreakEven)
+{
+    // 100 us pool start, 50 ns per triplet, 10 bytes and 25 ns of parsing per triplet
+    const Calibration calibration{100'000.0, 50.0, 2.5, 10.0};
+
+    const auto config{thresholds(calibration, 4)};
+    ASSERT_EQ(config.serialMaxTriplets, 2666);
+    ASSERT_EQ(config.serialMaxBytes, 17777);
+
+    const auto single{thresholds(calibration, 1)};
+    ASSERT_EQ(single.serialMaxTriplets, MAX_SERIAL_TRIPLETS);
+    ASSERT_EQ(single.serialMaxBytes, PlannerConfig::MAX_SERIAL_BYTES);
+
+    // slow pool start on a fast machine is capped
+    const auto capped{thresholds({1e12, 1.0, 0.1, 10.0}, 2)};
+    ASSERT_EQ(capped.serialMaxTriplets, MAX_SERIAL_TRIPLETS);
+    ASSERT_EQ(capped.serialMaxBytes, PlannerConfig::MAX_SERIAL_BYTES);
+}
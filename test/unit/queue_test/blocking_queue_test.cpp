@@ -157,3 +157,243 @@ TEST(BlockingQueueTest, Shutdown_ReadAllStoredItems)
 
     ASSERT_EQ(expectedItems, actualItems);
 }
+
+TEST(BlockingQueueTest, PushPopBatch_SingleThread)
+{
+    BlockingQueue<int> q{};
+
+    const std::vector<int> input{1, 2, 3, 4, 5, 6, 7};
+    q.waitPushBatch(input.begin(), input.end());
+
+    // empty range is a no-op
+    q.waitPushBatch(input.end(), input.end());
+
+    std::vector<int> out{100};
+    ASSERT_EQ(q.waitPopBatch(out, 3), 3);
+    ASSERT_EQ(out, (std::vector<int>{1, 2, 3}));
+
+    ASSERT_EQ(q.waitPopBatch(out, 10), 4);
+    ASSERT_EQ(out, (std::vector<int>{4, 5, 6, 7}));
+
+    q.shutdown();
+    ASSERT_EQ(q.waitPopBatch(out, 10), 0);
+    ASSERT_TRUE(out.empty());
+}
+
+TEST(BlockingQueueTest, WaitPopBatch_BlocksUntilPushOrShutdown)
+{
+    BlockingQueue<int> q{};
+    std::atomic<std::size_t> popped{100};
+
+    std::thread reader([&]
+    {
+        std::vector<int> out;
+        popped = q.waitPopBatch(out, 10);
+        popped = q.waitPopBatch(out, 10);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ(popped, 100);
+
+    const std::vector<int> input{1, 2};
+    q.waitPushBatch(input.begin(), input.end());
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ(popped, 2);
+
+    q.shutdown();
+    reader.join();
+    ASSERT_EQ(popped, 0);
+}
+
+TEST(BlockingQueueTest, BatchProducer_MultiBatchConsumerThreads)
+{
+    static constexpr int COUNT{50000};
+    static constexpr int THREADS{4};
+    static constexpr int BATCH{64};
+
+    struct alignas(constants::CACHE_SIZE) Slot
+    {
+        int hits{0};
+    };
+
+    std::vector<Slot> resultStorage(COUNT);
+    BlockingQueue<int> q{};
+
+    std::vector<std::thread> consumers;
+    consumers.reserve(THREADS);
+    for (int i = 0; i < THREADS; ++i)
+    {
+        consumers.emplace_back([&]()
+        {
+            std::vector<int> values;
+            while (q.waitPopBatch(values, BATCH) != 0)
+            {
+                for (int value : values)
+                {
+                    ++resultStorage[value].hits;
+                }
+            }
+        });
+    }
+
+    std::vector<int> input(COUNT);
+    for (int i = 0; i < COUNT; ++i)
+    {
+        input[i] = i;
+    }
+    for (int i = 0; i < COUNT; i += 1000)
+    {
+        q.waitPushBatch(input.begin() + i, input.begin() + std::min(COUNT, i + 1000));
+    }
+
+    q.shutdown();
+    for (auto& consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    for (int i = 0; i < COUNT; ++i)
+    {
+        ASSERT_EQ(resultStorage[i].hits, 1);
+    }
+}
+
+TEST(BlockingQueueTest, Construct_ZeroCapacity_Throws)
+{
+    ASSERT_THROW(BlockingQueue<int>{0}, std::invalid_argument);
+}
+
+TEST(BlockingQueueTest, TryPushTryPop_RespectCapacity)
+{
+    BlockingQueue<int> q{2};
+    ASSERT_EQ(q.capacity(), 2);
+
+    int out{0};
+    ASSERT_FALSE(q.tryPop(out));
+
+    ASSERT_TRUE(q.tryPush(1));
+    ASSERT_TRUE(q.tryPush(2));
+    ASSERT_FALSE(q.tryPush(3));
+
+    // the ring wraps around
+    ASSERT_TRUE(q.tryPop(out));
+    ASSERT_EQ(out, 1);
+    ASSERT_TRUE(q.tryPush(3));
+
+    ASSERT_TRUE(q.tryPop(out));
+    ASSERT_EQ(out, 2);
+    ASSERT_TRUE(q.tryPop(out));
+    ASSERT_EQ(out, 3);
+    ASSERT_FALSE(q.tryPop(out));
+}
+
+TEST(BlockingQueueTest, WaitPush_BlocksWhileFull)
+{
+    BlockingQueue<int> q{1};
+    ASSERT_TRUE(q.waitPush(1));
+
+    std::atomic<bool> pushed{false};
+    std::thread producer([&]
+    {
+        ASSERT_TRUE(q.waitPush(2));
+        pushed = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_FALSE(pushed);
+
+    int out{0};
+    ASSERT_TRUE(q.waitPop(out));
+    ASSERT_EQ(out, 1);
+    producer.join();
+
+    ASSERT_TRUE(pushed);
+    ASSERT_TRUE(q.waitPop(out));
+    ASSERT_EQ(out, 2);
+}
+
+TEST(BlockingQueueTest, WaitPushBatch_LargerThanCapacity)
+{
+    static constexpr int COUNT{1000};
+    BlockingQueue<int> q{16};
+
+    std::vector<int> actual{};
+    std::thread consumer([&]
+    {
+        std::vector<int> values;
+        while (q.waitPopBatch(values, 7) != 0)
+        {
+            actual.insert(actual.end(), values.begin(), values.end());
+        }
+    });
+
+    std::vector<int> input(COUNT);
+    for (int i = 0; i < COUNT; ++i)
+    {
+        input[i] = i;
+    }
+    ASSERT_TRUE(q.waitPushBatch(input.begin(), input.end()));
+
+    q.shutdown();
+    consumer.join();
+    ASSERT_EQ(actual, input);
+}
+
+TEST(BlockingQueueTest, WaitPopFor_TimesOut)
+{
+    BlockingQueue<int> q{};
+
+    int out{0};
+    const auto start{std::chrono::steady_clock::now()};
+    ASSERT_FALSE(q.waitPopFor(out, std::chrono::milliseconds(50)));
+    ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(50));
+
+    std::thread producer([&]
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        q.waitPush(7);
+    });
+    ASSERT_TRUE(q.waitPopFor(out, std::chrono::seconds(10)));
+    ASSERT_EQ(out, 7);
+    producer.join();
+}
+
+TEST(BlockingQueueTest, ShutdownAbort_DropsItemsAndWakesProducer)
+{
+    BlockingQueue<std::string> q{2};
+    ASSERT_TRUE(q.waitPush("1"));
+    ASSERT_TRUE(q.waitPush("2"));
+
+    std::atomic<int> pushResult{-1};
+    std::thread producer([&]
+    {
+        pushResult = q.waitPush("3");
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ(pushResult, -1);
+
+    q.shutdown(ShutdownMode::Abort);
+    producer.join();
+    ASSERT_EQ(pushResult, 0);
+
+    std::string out{};
+    ASSERT_FALSE(q.waitPop(out));
+    ASSERT_FALSE(q.tryPush("4"));
+}
+
+TEST(BlockingQueueTest, ShutdownDrain_RejectsNewItems)
+{
+    BlockingQueue<int> q{};
+    ASSERT_TRUE(q.waitPush(1));
+    q.shutdown(ShutdownMode::Drain);
+
+    ASSERT_FALSE(q.waitPush(2));
+    const std::vector<int> input{3, 4};
+    ASSERT_FALSE(q.waitPushBatch(input.begin(), input.end()));
+
+    int out{0};
+    ASSERT_TRUE(q.waitPop(out));
+    ASSERT_EQ(out, 1);
+    ASSERT_FALSE(q.waitPop(out));
+}
@@ -0,0 +1,105 @@
+#include "queue/chase_lev_deque.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace testing;
+using namespace tektask::queue;
+
+TEST(ChaseLevDequeTest, InvalidCapacity_ThrowsException)
+{
+    ASSERT_THROW(ChaseLevDeque<int>{0}, std::invalid_argument);
+    ASSERT_THROW(ChaseLevDeque<int>{1}, std::invalid_argument);
+    ASSERT_THROW(ChaseLevDeque<int>{100}, std::invalid_argument);
+    ASSERT_NO_THROW(ChaseLevDeque<int>{128});
+}
+
+TEST(ChaseLevDequeTest, PushPopSteal_SingleThread)
+{
+    ChaseLevDeque<int> deque{4};
+
+    int actual{0};
+    ASSERT_FALSE(deque.pop(actual));
+    ASSERT_FALSE(deque.steal(actual));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(deque.push(i));
+    }
+    ASSERT_FALSE(deque.push(4));
+    ASSERT_EQ(deque.size(), 4);
+
+    // owner end is LIFO, thief end is FIFO
+    ASSERT_TRUE(deque.pop(actual));
+    ASSERT_EQ(actual, 3);
+    ASSERT_TRUE(deque.steal(actual));
+    ASSERT_EQ(actual, 0);
+    ASSERT_TRUE(deque.steal(actual));
+    ASSERT_EQ(actual, 1);
+    ASSERT_TRUE(deque.pop(actual));
+    ASSERT_EQ(actual, 2);
+
+    ASSERT_FALSE(deque.pop(actual));
+    ASSERT_FALSE(deque.steal(actual));
+    ASSERT_EQ(deque.size(), 0);
+}
+
+TEST(ChaseLevDequeTest, OwnerAndThieves_EachItemTakenOnce)
+{
+    static constexpr int COUNT{200000};
+    static constexpr int THIEVES{3};
+
+    ChaseLevDeque<int> deque{256};
+    std::vector<std::atomic<int>> taken(COUNT);
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> thieves{};
+    for (int i = 0; i < THIEVES; ++i)
+    {
+        thieves.emplace_back([&]
+        {
+            int item{0};
+            while (!done.load())
+            {
+                if (deque.steal(item))
+                {
+                    ++taken[item];
+                }
+            }
+        });
+    }
+
+    // owner pushes everything and pops every other item itself, racing thieves for the last one
+    int item{0};
+    for (int i = 0; i < COUNT; ++i)
+    {
+        while (!deque.push(i))
+        {
+            if (deque.pop(item))
+            {
+                ++taken[item];
+            }
+        }
+        if (i % 2 == 0 && deque.pop(item))
+        {
+            ++taken[item];
+        }
+    }
+    while (deque.pop(item))
+    {
+        ++taken[item];
+    }
+
+    done.store(true);
+    for (auto& thief : thieves)
+    {
+        thief.join();
+    }
+
+    for (int i = 0; i < COUNT; ++i)
+    {
+        ASSERT_EQ(taken[i].load(), 1) << "item " << i;
+    }
+}
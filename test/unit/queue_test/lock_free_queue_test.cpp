@@ -0,0 +1,287 @@
+#include "utils/constants/constants.h"
+#include "queue/lock_free_queue.h"
+#include "resolver/quadratic_resolver.h"
+
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace testing;
+using namespace tektask::queue;
+using namespace tektask::resolver;
+using namespace tektask::utils;
+using namespace tektask::utils::types;
+
+TEST(LockFreeQueueTest, InvalidCapacity_ThrowsException)
+{
+    ASSERT_THROW(LockFreeQueue<int>{0}, std::invalid_argument);
+    ASSERT_THROW(LockFreeQueue<int>{1}, std::invalid_argument);
+    ASSERT_THROW(LockFreeQueue<int>{100}, std::invalid_argument);
+    ASSERT_NO_THROW(LockFreeQueue<int>{128});
+}
+
+TEST(LockFreeQueueTest, PushPop_SingleThread)
+{
+    LockFreeQueue<int> q{};
+    q.waitPush(123);
+
+    int actual{0};
+    ASSERT_TRUE(q.waitPop(actual));
+    ASSERT_EQ(actual, 123);
+}
+
+TEST(LockFreeQueueTest, TryPushPop_FullAndEmptyQueue)
+{
+    LockFreeQueue<int> q{4};
+
+    int actual{0};
+    ASSERT_FALSE(q.tryPop(actual));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(q.tryPush(int{i}));
+    }
+    ASSERT_FALSE(q.tryPush(4));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(q.tryPop(actual));
+        ASSERT_EQ(actual, i);
+    }
+    ASSERT_FALSE(q.tryPop(actual));
+}
+
+TEST(LockFreeQueueTest, WaitPop_BlocksUntilPush)
+{
+    LockFreeQueue<int> q{};
+    std::atomic<bool> pushed{false};
+
+    int result{0};
+    std::thread reader([&]
+    {
+        ASSERT_TRUE(q.waitPop(result));
+        pushed = true;
+    });
+
+    // verify no spurious readings in reader thread
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_FALSE(pushed);
+
+    q.waitPush(123);
+    reader.join();
+
+    ASSERT_EQ(result, 123);
+}
+
+TEST(LockFreeQueueTest, WaitPush_BlocksWhileFull)
+{
+    LockFreeQueue<int> q{2};
+    q.waitPush(1);
+    q.waitPush(2);
+
+    std::atomic<bool> pushed{false};
+    std::thread writer([&]
+    {
+        q.waitPush(3);
+        pushed = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_FALSE(pushed);
+
+    int actual{0};
+    ASSERT_TRUE(q.waitPop(actual));
+    writer.join();
+    ASSERT_TRUE(pushed);
+
+    ASSERT_TRUE(q.waitPop(actual));
+    ASSERT_EQ(actual, 2);
+    ASSERT_TRUE(q.waitPop(actual));
+    ASSERT_EQ(actual, 3);
+}
+
+TEST(LockFreeQueueTest, BlockPop_UntilShutdown)
+{
+    LockFreeQueue<int> q{};
+    std::atomic<bool> popResult{true};
+
+    std::thread consumer([&]
+    {
+        int out;
+        popResult = q.waitPop(out);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    q.shutdown();
+
+    consumer.join();
+    ASSERT_FALSE(popResult);
+}
+
+TEST(LockFreeQueueTest, Shutdown_ReadAllStoredItems)
+{
+    LockFreeQueue<int> q{16};
+
+    std::vector<int> expectedItems{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    std::vector<int> actualItems{};
+    actualItems.reserve(expectedItems.size());
+
+    for (int item : expectedItems)
+    {
+        q.waitPush(item);
+    }
+
+    std::thread reader([&]
+    {
+        int result{0};
+        while (q.waitPop(result))
+        {
+            actualItems.push_back(result);
+        }
+    });
+
+    // read all enqueued items after shutdown
+    q.shutdown();
+    reader.join();
+
+    ASSERT_EQ(expectedItems, actualItems);
+}
+
+TEST(LockFreeQueueTest, MultiProducer_MultiConsumerThreads)
+{
+    static constexpr int COUNT{200000};
+    static constexpr int PRODUCERS{3};
+    static constexpr int CONSUMERS{4};
+
+    struct alignas(constants::CACHE_SIZE) Slot
+    {
+        int hits{0};
+    };
+
+    // small capacity forces producers to wait on a full queue
+    std::vector<Slot> resultStorage(COUNT);
+    LockFreeQueue<int> q{256};
+
+    std::vector<std::thread> consumers;
+    consumers.reserve(CONSUMERS);
+    for (int i = 0; i < CONSUMERS; ++i)
+    {
+        consumers.emplace_back([&]()
+        {
+            int value;
+            while (q.waitPop(value))
+            {
+                ++resultStorage[value].hits;
+            }
+        });
+    }
+
+    std::vector<std::thread> producers;
+    producers.reserve(PRODUCERS);
+    for (int p = 0; p < PRODUCERS; ++p)
+    {
+        producers.emplace_back([&, p]()
+        {
+            for (int i = p; i < COUNT; i += PRODUCERS)
+            {
+                q.waitPush(i);
+            }
+        });
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    q.shutdown();
+    for (auto& consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    for (int i = 0; i < COUNT; ++i)
+    {
+        ASSERT_EQ(resultStorage[i].hits, 1);
+    }
+}
+
+TEST(LockFreeQueueTest, DropInForResolver)
+{
+    using Queue = LockFreeQueue<Triplet>;
+    static constexpr int COUNT{10000};
+
+    std::vector<EquationSolveResult> results(COUNT);
+    std::vector<tektask::storage::TextArena> arenas(2);
+    Queue queue{1024};
+
+    std::vector<std::thread> consumers;
+    for (auto& arena : arenas)
+    {
+        consumers.emplace_back(QuadraticEquationResolver<Queue>(queue, results, arena));
+    }
+
+    for (int i = 0; i < COUNT; ++i)
+    {
+        queue.waitPush(Triplet{1, -2, -3, i});
+    }
+
+    queue.shutdown();
+    for (auto& consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    for (const auto& result : results)
+    {
+        ASSERT_EQ(result.result, "(1, -2, -3) => (3, -1), Xmin=1");
+    }
+}
+
+TEST(LockFreeQueueTest, PushPopBatch_SingleThread)
+{
+    LockFreeQueue<int> q{8};
+
+    const std::vector<int> input{1, 2, 3, 4, 5};
+    q.waitPushBatch(input.begin(), input.end());
+
+    std::vector<int> out{};
+    ASSERT_EQ(q.waitPopBatch(out, 2), 2);
+    ASSERT_EQ(out, (std::vector<int>{1, 2}));
+
+    ASSERT_EQ(q.waitPopBatch(out, 10), 3);
+    ASSERT_EQ(out, (std::vector<int>{3, 4, 5}));
+
+    q.shutdown();
+    ASSERT_EQ(q.waitPopBatch(out, 10), 0);
+    ASSERT_TRUE(out.empty());
+}
+
+TEST(LockFreeQueueTest, Shutdown_RejectsNewItemsAndWakesProducer)
+{
+    LockFreeQueue<int> q{2};
+    ASSERT_TRUE(q.waitPush(1));
+    ASSERT_TRUE(q.waitPush(2));
+
+    std::atomic<int> pushResult{-1};
+    std::thread producer([&]
+    {
+        pushResult = q.waitPush(3);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_EQ(pushResult, -1);
+
+    q.shutdown();
+    producer.join();
+    ASSERT_EQ(pushResult, 0);
+
+    const std::vector<int> input{4, 5};
+    ASSERT_FALSE(q.waitPushBatch(input.begin(), input.end()));
+
+    int out{0};
+    ASSERT_TRUE(q.waitPop(out));
+    ASSERT_EQ(out, 1);
+    ASSERT_TRUE(q.waitPop(out));
+    ASSERT_EQ(out, 2);
+    ASSERT_FALSE(q.waitPop(out));
+}
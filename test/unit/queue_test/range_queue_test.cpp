@@ -0,0 +1,97 @@
+#include "utils/constants/constants.h"
+#include "queue/range_queue.h"
+
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace testing;
+using namespace tektask::queue;
+using namespace tektask::utils;
+
+TEST(RangeQueueTest, Pop_AllItemsInOrder)
+{
+    const std::vector<int> source{1, 2, 3, 4, 5};
+    RangeQueue queue{source};
+
+    std::vector<int> actual{};
+    int value{0};
+    while (queue.waitPop(value))
+    {
+        actual.emplace_back(value);
+    }
+
+    ASSERT_EQ(actual, source);
+
+    // exhausted queue stays exhausted, shutdown doesn't change it
+    queue.shutdown();
+    ASSERT_FALSE(queue.waitPop(value));
+}
+
+TEST(RangeQueueTest, Pop_EmptySource)
+{
+    const std::vector<int> source{};
+    RangeQueue queue{source};
+
+    int value{0};
+    ASSERT_FALSE(queue.waitPop(value));
+}
+
+TEST(RangeQueueTest, MultiConsumerThreads_EachItemPoppedOnce)
+{
+    static constexpr int COUNT{50000};
+    static constexpr int THREADS{4};
+
+    struct alignas(constants::CACHE_SIZE) Slot
+    {
+        int hits{0};
+    };
+
+    std::vector<int> source(COUNT);
+    for (int i = 0; i < COUNT; ++i)
+    {
+        source[i] = i;
+    }
+
+    std::vector<Slot> resultStorage(COUNT);
+    RangeQueue queue{source};
+
+    std::vector<std::thread> consumers;
+    consumers.reserve(THREADS);
+    for (int i = 0; i < THREADS; ++i)
+    {
+        consumers.emplace_back([&]()
+        {
+            int value;
+            while (queue.waitPop(value))
+            {
+                ++resultStorage[value].hits;
+            }
+        });
+    }
+
+    for (auto& consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    for (int i = 0; i < COUNT; ++i)
+    {
+        ASSERT_EQ(resultStorage[i].hits, 1);
+    }
+}
+
+TEST(RangeQueueTest, PopBatch_ClaimsConsecutiveItems)
+{
+    const std::vector<int> source{1, 2, 3, 4, 5};
+    RangeQueue queue{source};
+
+    std::vector<int> out{};
+    ASSERT_EQ(queue.waitPopBatch(out, 2), 2);
+    ASSERT_EQ(out, (std::vector<int>{1, 2}));
+
+    ASSERT_EQ(queue.waitPopBatch(out, 10), 3);
+    ASSERT_EQ(out, (std::vector<int>{3, 4, 5}));
+
+    ASSERT_EQ(queue.waitPopBatch(out, 10), 0);
+    ASSERT_TRUE(out.empty());
+}
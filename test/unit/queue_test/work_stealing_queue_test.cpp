@@ -0,0 +1,229 @@
+#include "queue/work_stealing_queue.h"
+#include "resolver/quadratic_resolver.h"
+
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace testing;
+using namespace tektask::queue;
+using namespace tektask::resolver;
+using namespace tektask::utils::types;
+
+TEST(WorkStealingQueueTest, PushPop_SingleThread)
+{
+    WorkStealingQueue<int> q{};
+    q.waitPush(123);
+
+    int actual{0};
+    ASSERT_TRUE(q.waitPop(actual));
+    ASSERT_EQ(actual, 123);
+}
+
+TEST(WorkStealingQueueTest, PopBatch_SplitsPushedBatch)
+{
+    WorkStealingQueue<int> q{};
+    const std::vector<int> items{0, 1, 2, 3, 4, 5, 6};
+    q.waitPushBatch(items.begin(), items.end());
+    q.shutdown();
+
+    // the rest of the batch stays in the consumer deque and is popped next
+    std::vector<int> out{};
+    ASSERT_EQ(q.waitPopBatch(out, 3), 3);
+    ASSERT_EQ(out, (std::vector<int>{0, 1, 2}));
+    ASSERT_EQ(q.waitPopBatch(out, 3), 3);
+    ASSERT_EQ(out, (std::vector<int>{3, 4, 5}));
+    ASSERT_EQ(q.waitPopBatch(out, 3), 1);
+    ASSERT_EQ(out, (std::vector<int>{6}));
+    ASSERT_EQ(q.waitPopBatch(out, 3), 0);
+}
+
+TEST(WorkStealingQueueTest, BlockPop_UntilShutdown)
+{
+    WorkStealingQueue<int> q{};
+
+    std::atomic<bool> finished{false};
+    std::thread reader([&]
+    {
+        int item{0};
+        ASSERT_FALSE(q.waitPop(item));
+        finished = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_FALSE(finished.load());
+
+    q.shutdown();
+    reader.join();
+    ASSERT_TRUE(finished.load());
+}
+
+TEST(WorkStealingQueueTest, WorkerSlotsExhausted_ThrowsException)
+{
+    WorkStealingQueue<int> q{1};
+    q.shutdown();
+
+    std::vector<int> out{};
+    ASSERT_EQ(q.waitPopBatch(out, 1), 0);
+
+    std::thread other([&]
+    {
+        ASSERT_THROW(q.waitPopBatch(out, 1), std::length_error);
+    });
+    other.join();
+}
+
+TEST(WorkStealingQueueTest, SwitchingQueues_KeepsWorkerSlot)
+{
+    WorkStealingQueue<int> first{1};
+    WorkStealingQueue<int> second{1};
+    first.shutdown();
+    second.shutdown();
+
+    // a single slot per queue is enough for a thread alternating between them
+    std::vector<int> out{};
+    for (int round = 0; round < 3; ++round)
+    {
+        ASSERT_EQ(first.waitPopBatch(out, 1), 0);
+        ASSERT_EQ(second.waitPopBatch(out, 1), 0);
+    }
+}
+
+TEST(WorkStealingQueueTest, SlowConsumer_RemainderIsStolen)
+{
+    WorkStealingQueue<int> q{};
+    const std::vector<int> items(100, 1);
+    q.waitPushBatch(items.begin(), items.end());
+
+    // the first consumer takes a block and stalls, the second one steals the remainder
+    std::vector<int> first{};
+    ASSERT_EQ(q.waitPopBatch(first, 10), 10);
+
+    std::size_t stolen{0};
+    std::thread thief([&]
+    {
+        std::vector<int> out{};
+        while (q.waitPopBatch(out, 10) != 0)
+        {
+            stolen += out.size();
+        }
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    q.shutdown();
+    thief.join();
+    ASSERT_EQ(stolen, 90);
+}
+
+TEST(WorkStealingQueueTest, BatchProducer_MultiConsumerThreads)
+{
+    static constexpr int COUNT{100000};
+    static constexpr int CONSUMERS{4};
+
+    WorkStealingQueue<int> q{};
+    std::vector<std::atomic<int>> hits(COUNT);
+
+    std::vector<std::thread> consumers{};
+    for (int i = 0; i < CONSUMERS; ++i)
+    {
+        consumers.emplace_back([&]
+        {
+            std::vector<int> out{};
+            while (q.waitPopBatch(out, 64) != 0)
+            {
+                for (const auto item : out)
+                {
+                    ++hits[item];
+                }
+            }
+        });
+    }
+
+    std::vector<int> batch{};
+    for (int i = 0; i < COUNT; i += static_cast<int>(batch.size()))
+    {
+        batch.clear();
+        for (int j = i; j < std::min(COUNT, i + 1000); ++j)
+        {
+            batch.push_back(j);
+        }
+        q.waitPushBatch(batch.begin(), batch.end());
+    }
+
+    q.shutdown();
+    for (auto& consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    for (int i = 0; i < COUNT; ++i)
+    {
+        ASSERT_EQ(hits[i].load(), 1) << "item " << i;
+    }
+}
+
+TEST(WorkStealingQueueTest, DropInForResolver)
+{
+    using Queue = WorkStealingQueue<Triplet>;
+    static constexpr int COUNT{10000};
+
+    std::vector<EquationSolution> results(COUNT);
+    Queue queue{};
+
+    std::vector<std::thread> consumers;
+    for (int i = 0; i < 2; ++i)
+    {
+        consumers.emplace_back(QuadraticEquationResolver<Queue, std::vector<EquationSolution>>(queue, results));
+    }
+
+    std::vector<Triplet> batch{};
+    for (int i = 0; i < COUNT; ++i)
+    {
+        batch.push_back(Triplet{1, -2, -3, i});
+        if (batch.size() == 1000)
+        {
+            queue.waitPushBatch(batch.begin(), batch.end());
+            batch.clear();
+        }
+    }
+
+    queue.shutdown();
+    for (auto& consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    for (const auto& result : results)
+    {
+        ASSERT_EQ(result, (EquationSolution{SolveCase::TwoRoots, 3, -1, 1}));
+    }
+}
+
+TEST(WorkStealingQueueTest, Shutdown_RejectsNewItemsAndWakesProducer)
+{
+    WorkStealingQueue<int> q{1, 2};
+    ASSERT_TRUE(q.waitPush(1));
+    ASSERT_TRUE(q.waitPush(2));
+
+    std::atomic<int> pushResult{-1};
+    std::thread producer([&]
+    {
+        pushResult = q.waitPush(3);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_EQ(pushResult, -1);
+
+    q.shutdown();
+    producer.join();
+    ASSERT_EQ(pushResult, 0);
+
+    const std::vector<int> input{4, 5};
+    ASSERT_FALSE(q.waitPushBatch(input.begin(), input.end()));
+
+    std::vector<int> out{};
+    ASSERT_EQ(q.waitPopBatch(out, 4), 1);
+    ASSERT_EQ(out, (std::vector<int>{1}));
+    ASSERT_EQ(q.waitPopBatch(out, 4), 1);
+    ASSERT_EQ(out, (std::vector<int>{2}));
+    ASSERT_EQ(q.waitPopBatch(out, 4), 0);
+}
@@ -0,0 +1,134 @@
+#include "resolver/exact_discriminant.h"
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <limits>
+#include <random>
+
+using namespace testing;
+using namespace tektask::resolver;
+using namespace tektask::utils::types;
+
+namespace
+{
+    constexpr auto MIN{std::numeric_limits<int64_t>::min()};
+    constexpr auto MAX{std::numeric_limits<int64_t>::max()};
+
+    bool bitEqual(double lhs, double rhs)
+    {
+        return std::memcmp(&lhs, &rhs, sizeof(double)) == 0;
+    }
+}
+
+
+TEST(ExactDiscriminantTest, FitsDoubleDiscriminant_Bounds)
+{
+    ASSERT_TRUE(fitsDoubleDiscriminant(0, 0, 0));
+    ASSERT_TRUE(fitsDoubleDiscriminant(EXACT_DOUBLE_LIMIT - 1, -EXACT_DOUBLE_LIMIT, 7));
+
+    ASSERT_FALSE(fitsDoubleDiscriminant(EXACT_DOUBLE_LIMIT, 0, 0));
+    ASSERT_FALSE(fitsDoubleDiscriminant(0, -EXACT_DOUBLE_LIMIT - 1, 0));
+    ASSERT_FALSE(fitsDoubleDiscriminant(0, 0, MIN));
+    ASSERT_FALSE(fitsDoubleDiscriminant(MAX, 0, 0));
+}
+
+TEST(ExactDiscriminantTest, DiscriminantSign_ExtremeCoefficients)
+{
+    // b*b - 4*a*c beyond the __int128 range on both sides
+    ASSERT_EQ(discriminantSign(MIN, MIN, MIN), -1);
+    ASSERT_EQ(discriminantSign(MIN, 0, MIN), -1);
+    ASSERT_EQ(discriminantSign(MAX, MIN, MIN), 1);
+    ASSERT_EQ(discriminantSign(MIN, MIN, MAX), 1);
+
+    // (2^32 + 1)^2 - 4 * 2^31 * (2^31 + 1) == 1
+    ASSERT_EQ(discriminantSign(int64_t{1} << 31, (int64_t{1} << 32) + 1, (int64_t{1} << 31) + 1), 1);
+    // 2^62 * 2^62 - 4 * 2^62 * 2^60 == 0
+    ASSERT_EQ(discriminantSign(int64_t{1} << 62, int64_t{1} << 62, int64_t{1} << 60), 0);
+    ASSERT_EQ(discriminantSign(1, 0, 1), -1);
+}
+
+TEST(ExactDiscriminantTest, SolveExact_ClassifiesWhereDoubleRounds)
+{
+    // exact D == 1, double D == 0
+    const int64_t a{int64_t{1} << 31};
+    const int64_t b{(int64_t{1} << 32) + 1};
+    const int64_t c{(int64_t{1} << 31) + 1};
+    ASSERT_EQ(solve(double(a), double(b), double(c)).kind, SolveCase::SingleRoot);
+    ASSERT_EQ(solveExact(a, b, c).kind, SolveCase::TwoRoots);
+
+    // exact D == -3, double D == 0
+    const int64_t wideC{(int64_t{1} << 62) + (int64_t{1} << 31) + 1};
+    ASSERT_EQ(solve(1.0, double(b), double(wideC)).kind, SolveCase::SingleRoot);
+    ASSERT_EQ(solveExact(1, b, wideC).kind, SolveCase::NoRealRoots);
+
+    // exact D == 0 with double rounding of a*c
+    const int64_t k{3'037'000'493};
+    ASSERT_EQ(solveExact(k, 2 * k * 3, 9 * k), (EquationSolution{SolveCase::SingleRoot, -3.0, 0.0, -3.0}));
+}
+
+TEST(ExactDiscriminantTest, SolveExact_PerfectSquareRoots)
+{
+    // (x - 3'000'000'001)(x + 2'000'000'003), integer roots are exact
+    const int64_t r1{3'000'000'001};
+    const int64_t r2{-2'000'000'003};
+    const auto solution{solveExact(1, -(r1 + r2), r1 * r2)};
+    ASSERT_EQ(solution.kind, SolveCase::TwoRoots);
+    ASSERT_EQ(solution.x1, double(r1));
+    ASSERT_EQ(solution.x2, double(r2));
+
+    // a zero root keeps the sign direct solving gives it
+    const auto zero{solveExact(-(int64_t{1} << 40), int64_t{1} << 41, 0)};
+    ASSERT_EQ(zero.kind, SolveCase::TwoRoots);
+    ASSERT_EQ(zero.x1, 0.0);
+    ASSERT_TRUE(std::signbit(zero.x1));
+    ASSERT_EQ(zero.x2, 2.0);
+}
+
+TEST(ExactDiscriminantTest, SolveExact_SmallCoefficientsMatchSolve)
+{
+    std::mt19937_64 engine{42};
+    std::uniform_int_distribution<int64_t> medium(-EXACT_DOUBLE_LIMIT, EXACT_DOUBLE_LIMIT - 1);
+
+    for (int i = 0; i < 100'000; ++i)
+    {
+        const auto a{medium(engine) >> (i % 27)};
+        const auto b{medium(engine)};
+        const auto c{medium(engine) >> (i % 13)};
+        const auto expected{solve(double(a), double(b), double(c))};
+        const auto actual{solveExact(a, b, c)};
+        ASSERT_EQ(expected.kind, actual.kind);
+        ASSERT_TRUE(bitEqual(expected.x1, actual.x1));
+        ASSERT_TRUE(bitEqual(expected.x2, actual.x2));
+        ASSERT_TRUE(bitEqual(expected.xMin, actual.xMin));
+    }
+}
+
+TEST(ExactDiscriminantTest, SolveWide_RootsSatisfyEquation)
+{
+    std::mt19937_64 engine{7};
+    std::uniform_int_distribution<int64_t> full{MIN + 1, MAX};
+
+    for (int i = 0; i < 100'000; ++i)
+    {
+        const auto a{full(engine) >> (i % 40)};
+        const auto b{full(engine) >> (i % 20)};
+        const auto c{full(engine) >> (i % 30)};
+        const auto solution{solveWide(a, b, c)};
+
+        // negated coefficients give the same roots in the opposite order, the solution cache relies on it
+        const auto negated{solveWide(-a, -b, -c)};
+        ASSERT_EQ(solution.kind, negated.kind);
+        ASSERT_TRUE(bitEqual(solution.xMin, negated.xMin));
+        if (solution.kind != SolveCase::TwoRoots)
+        {
+            continue;
+        }
+        ASSERT_TRUE(bitEqual(solution.x1, negated.x2)) << a << " " << b << " " << c;
+        ASSERT_TRUE(bitEqual(solution.x2, negated.x1)) << a << " " << b << " " << c;
+
+        // Vieta: x1 + x2 == -b/a, x1 * x2 == c/a, up to rounding
+        const long double sum{static_cast<long double>(solution.x1) + solution.x2};
+        const long double scale{std::fabs(static_cast<long double>(solution.x1)) + std::fabs(solution.x2)};
+        ASSERT_LE(std::fabs(sum + static_cast<long double>(b) / a), 1e-12L * scale) << a << " " << b << " " << c;
+    }
+}
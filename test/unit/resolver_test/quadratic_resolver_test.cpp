@@ -1,5 +1,6 @@
 #include "resolver/quadratic_resolver.h"
 #include "queue/blocking_queue.h"
+#include "thread/chunked_range.h"
 
 #include <gtest/gtest.h>
 #include <random>
@@ -7,6 +8,8 @@
 
 using namespace testing;
 using namespace tektask::queue;
+using namespace tektask::thread;
+using namespace tektask::storage;
 using namespace tektask::resolver;
 using namespace tektask::utils::types;
 
@@ -24,6 +27,7 @@ struct ResolverTestCase
 
 DummyQueue dummyQueue{};
 std::vector<EquationSolveResult> dummyResolverResults{};
+TextArena dummyArena{};
 
 
 TEST(QuadraticResolverTest, Resolve_ZeroACoefficientVariations)
@@ -39,7 +43,7 @@ TEST(QuadraticResolverTest, Resolve_ZeroACoefficientVariations)
         {{0, 0, 10}, "(0, 0, 10) => no solution, no extremum"},
     };
 
-    QuadraticEquationResolver<DummyQueue> resolver(dummyQueue, dummyResolverResults);
+    QuadraticEquationResolver<DummyQueue> resolver(dummyQueue, dummyResolverResults, dummyArena);
 
     std::string actual{};
     for (const auto& testCase : cases)
@@ -53,7 +57,7 @@ TEST(QuadraticResolverTest, Resolve_NoRealRoots)
 {
     ResolverTestCase testCase{{1, 0, 1}, "(1, 0, 1) => no real roots, Xmin=0"};
 
-    QuadraticEquationResolver<DummyQueue> resolver(dummyQueue, dummyResolverResults);
+    QuadraticEquationResolver<DummyQueue> resolver(dummyQueue, dummyResolverResults, dummyArena);
     auto actual{resolver.resolve(testCase.triplet)};
     ASSERT_EQ(actual, testCase.expected);
 }
@@ -62,7 +66,7 @@ TEST(QuadraticResolverTest, Resolve_SingleRoot)
 {
     ResolverTestCase testCase{{1, 2, 1}, "(1, 2, 1) => (-1), Xmin=-1"};
 
-    QuadraticEquationResolver<DummyQueue> resolver(dummyQueue, dummyResolverResults);
+    QuadraticEquationResolver<DummyQueue> resolver(dummyQueue, dummyResolverResults, dummyArena);
     auto actual{resolver.resolve(testCase.triplet)};
     ASSERT_EQ(actual, testCase.expected);
 }
@@ -71,7 +75,7 @@ TEST(QuadraticResolverTest, Resolve_TwoRoots)
 {
     ResolverTestCase testCase{{1, -2, -3}, "(1, -2, -3) => (3, -1), Xmin=1"};
 
-    QuadraticEquationResolver<DummyQueue> resolver(dummyQueue, dummyResolverResults);
+    QuadraticEquationResolver<DummyQueue> resolver(dummyQueue, dummyResolverResults, dummyArena);
     auto actual{resolver.resolve(testCase.triplet)};
     ASSERT_EQ(actual, testCase.expected);
 }
@@ -116,11 +120,12 @@ TEST(QuadraticResolverTest, Resolve_1MSetOfPredefinedCases)
     consumers.reserve(CONSUMERS_COUNT);
 
     std::vector<EquationSolveResult> resolverResults{TRIPLETS_COUNT};
+    std::vector<TextArena> arenas(CONSUMERS_COUNT);
     Queue queue{};
 
     for (int i = 0; i < CONSUMERS_COUNT; ++i)
     {
-        consumers.emplace_back(QuadraticEquationResolver<Queue>(queue, resolverResults));
+        consumers.emplace_back(QuadraticEquationResolver<Queue>(queue, resolverResults, arenas[i]));
     }
 
     for (const auto& data : producerTripletsData)
@@ -140,3 +145,142 @@ TEST(QuadraticResolverTest, Resolve_1MSetOfPredefinedCases)
         ASSERT_EQ(producerTripletsData[i].expected, resolverResults[i].result);
     }
 }
+
+TEST(QuadraticResolverTest, ResolveBatch_MatchesSingleResolve)
+{
+    std::vector<Triplet> triplets{};
+    for (int64_t i = 0; i < 1000; ++i)
+    {
+        triplets.push_back({i % 7 - 3, i % 11 - 5, i % 13 - 6, i});
+    }
+
+    std::vector<EquationSolveResult> results(triplets.size());
+    QuadraticEquationResolver<DummyQueue> resolver(dummyQueue, results, dummyArena);
+    resolver.resolveBatch(triplets.data(), triplets.size());
+
+    for (const auto& triplet : triplets)
+    {
+        ASSERT_EQ(resolver.resolve(triplet), results[triplet.id].result);
+    }
+}
+
+TEST(QuadraticResolverTest, ResolveBatch_WideCoefficientsExact)
+{
+    std::mt19937_64 engine{11};
+    std::uniform_int_distribution<int64_t> full{};
+
+    // small and wide triplets interleaved, wide ones include a double misclassification
+    std::vector<Triplet> triplets{};
+    for (int64_t i = 0; i < 1000; ++i)
+    {
+        triplets.push_back({i % 7 - 3, i % 11 - 5, i % 13 - 6, 3 * i});
+        triplets.push_back({full(engine) >> (i % 50), full(engine) >> (i % 40), full(engine) >> (i % 30), 3 * i + 1});
+        triplets.push_back({int64_t{1} << 31, (int64_t{1} << 32) + 1, (int64_t{1} << 31) + 1, 3 * i + 2});
+    }
+
+    std::vector<EquationSolution> results(triplets.size());
+    QuadraticEquationResolver<DummyQueue, std::vector<EquationSolution>> resolver(dummyQueue, results);
+    resolver.resolveBatch(triplets.data(), triplets.size());
+
+    for (const auto& t : triplets)
+    {
+        ASSERT_EQ(results[t.id], solveExact(t.a, t.b, t.c));
+    }
+    ASSERT_EQ(results[2].kind, SolveCase::TwoRoots);
+}
+
+TEST(QuadraticResolverTest, ResolverOptions_SpecializationsMatchGeneric)
+{
+    using tektask::stats::Stage;
+
+    std::vector<Triplet> triplets{};
+    for (int64_t i = 0; i < 1000; ++i)
+    {
+        triplets.push_back({i % 7 - 3, i % 11 - 5, i % 13 - 6, i});
+    }
+
+    auto solveWith = [&](auto options)
+    {
+        using Options = decltype(options);
+        std::vector<EquationSolution> results(triplets.size());
+        QuadraticEquationResolver<DummyQueue, std::vector<EquationSolution>, Options> resolver(dummyQueue, results);
+        resolver.resolveBatch(triplets.data(), triplets.size());
+        return results;
+    };
+
+    const auto expected{solveWith(ResolverOptions<>{})};
+    ASSERT_EQ(solveWith(ResolverOptions<CoefficientRange::Narrow, true>{}), expected);
+
+    // uninstrumented instantiations leave statistics untouched
+    const auto before{tektask::stats::collect().stages[static_cast<std::size_t>(Stage::Resolve)].count()};
+    ASSERT_EQ(solveWith(ResolverOptions<CoefficientRange::Full, false>{}), expected);
+    ASSERT_EQ(solveWith(ResolverOptions<CoefficientRange::Narrow, false>{}), expected);
+    ASSERT_EQ(tektask::stats::collect().stages[static_cast<std::size_t>(Stage::Resolve)].count(), before);
+}
+
+TEST(QuadraticResolverTest, StructuredResults_NoTextFormatting)
+{
+    using Queue = BlockingQueue<Triplet>;
+    using Resolver = QuadraticEquationResolver<Queue, std::vector<EquationSolution>>;
+    static constexpr int COUNT{1000};
+
+    static_assert(sizeof(EquationSolution) <= 32);
+
+    std::vector<EquationSolution> results(COUNT);
+    Queue queue{};
+
+    std::vector<std::thread> consumers{};
+    for (int i = 0; i < 2; ++i)
+    {
+        consumers.emplace_back(Resolver(queue, results));
+    }
+
+    for (int i = 0; i < COUNT; ++i)
+    {
+        queue.waitPush(i % 2 ? Triplet{1, -2, -3, i} : Triplet{0, 5, -10, i});
+    }
+
+    queue.shutdown();
+    for (auto& consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    for (int i = 0; i < COUNT; ++i)
+    {
+        const auto expected{i % 2 ? EquationSolution{SolveCase::TwoRoots, 3, -1, 1} : EquationSolution{SolveCase::Linear, 2}};
+        ASSERT_EQ(results[i], expected);
+    }
+}
+
+TEST(QuadraticResolverTest, ChunkedRangeInput_SolvesInPlace)
+{
+    using Input = ChunkedRange<Triplet>;
+    using Resolver = QuadraticEquationResolver<Input, std::vector<EquationSolution>>;
+    static constexpr int COUNT{10000};
+
+    std::vector<Triplet> triplets{};
+    for (int i = 0; i < COUNT; ++i)
+    {
+        triplets.push_back(i % 2 ? Triplet{1, -2, -3, i} : Triplet{0, 5, -10, i});
+    }
+
+    std::vector<EquationSolution> results(COUNT);
+    Input input{triplets.data(), triplets.size(), 2, SOLVE_BLOCK_SIZE};
+
+    std::vector<std::thread> consumers{};
+    for (int i = 0; i < 2; ++i)
+    {
+        consumers.emplace_back(Resolver(input, results));
+    }
+    for (auto& consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    for (int i = 0; i < COUNT; ++i)
+    {
+        const auto expected{i % 2 ? EquationSolution{SolveCase::TwoRoots, 3, -1, 1} : EquationSolution{SolveCase::Linear, 2}};
+        ASSERT_EQ(results[i], expected);
+    }
+}
@@ -0,0 +1,98 @@
+#include "resolver/result_formatter.h"
+#include "resolver/solve_kernel.h"
+
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <sstream>
+
+using namespace testing;
+using namespace tektask::resolver;
+using namespace tektask::utils::types;
+
+namespace
+{
+    /**
+     * @brief Reference std::ostream based formatting, the output has to match it byte to byte.
+     */
+    std::string streamFormat(const Triplet& t, const EquationSolution& solution)
+    {
+        std::stringstream stream;
+        stream << "(" << t.a << ", " << t.b << ", " << t.c << ") => ";
+        switch (solution.kind)
+        {
+        case SolveCase::InfiniteRoots:
+            stream << "infinite roots, no extremum";
+            return stream.str();
+        case SolveCase::NoSolution:
+            stream << "no solution, no extremum";
+            return stream.str();
+        case SolveCase::Linear:
+            stream << "(" << solution.x1 << "), no extremum";
+            return stream.str();
+        case SolveCase::NoRealRoots:
+            stream << "no real roots";
+            break;
+        case SolveCase::SingleRoot:
+            stream << "(" << solution.x1 << ")";
+            break;
+        case SolveCase::TwoRoots:
+            stream << "(" << solution.x1 << ", " << solution.x2 << ")";
+            break;
+        }
+        stream << ", Xmin=" << solution.xMin;
+        return stream.str();
+    }
+
+    std::string format(const Triplet& t)
+    {
+        const auto solution{solve(static_cast<double>(t.a), static_cast<double>(t.b), static_cast<double>(t.c))};
+        std::array<char, MAX_RESULT_LENGTH> text{};
+        return {text.data(), formatResult(text.data(), t, solution)};
+    }
+}
+
+
+TEST(ResultFormatterTest, Format_AllSolutionKinds)
+{
+    ASSERT_EQ(format({0, 10, -10}), "(0, 10, -10) => (1), no extremum");
+    ASSERT_EQ(format({0, 0, 0}), "(0, 0, 0) => infinite roots, no extremum");
+    ASSERT_EQ(format({0, 0, 10}), "(0, 0, 10) => no solution, no extremum");
+    ASSERT_EQ(format({1, 0, 1}), "(1, 0, 1) => no real roots, Xmin=0");
+    ASSERT_EQ(format({1, 2, 1}), "(1, 2, 1) => (-1), Xmin=-1");
+    ASSERT_EQ(format({1, -2, -3}), "(1, -2, -3) => (3, -1), Xmin=1");
+    ASSERT_EQ(format({2, -6, -8}), "(2, -6, -8) => (4, -1), Xmin=1.5");
+
+    // negative zero root is kept, Xmin is normalized
+    ASSERT_EQ(format({1, 0, 0}), "(1, 0, 0) => (-0), Xmin=0");
+    ASSERT_EQ(format({0, 5, 0}), "(0, 5, 0) => (-0), no extremum");
+}
+
+TEST(ResultFormatterTest, Format_MatchesStreamFormatting)
+{
+    constexpr auto min{std::numeric_limits<int64_t>::min()};
+    constexpr auto max{std::numeric_limits<int64_t>::max()};
+
+    std::vector<Triplet> triplets{
+        {min, min, min}, {max, max, max}, {min, max, min}, {1, max, 1}, {max, 1, -max},
+        {3, 1, -7}, {7, 1, 0}, {1, 1000000, 1}, {1000000, 1, 1}, {-1, 0, 123456789},
+    };
+
+    std::mt19937_64 engine{7};
+    std::uniform_int_distribution<int64_t> small(-1000, 1000);
+    std::uniform_int_distribution<int64_t> full{};
+    for (int i = 0; i < 20000; ++i)
+    {
+        triplets.push_back({small(engine), small(engine), small(engine)});
+        triplets.push_back({full(engine), full(engine), full(engine)});
+        triplets.push_back({small(engine), full(engine), small(engine)});
+    }
+
+    for (const auto& t : triplets)
+    {
+        const auto solution{solve(static_cast<double>(t.a), static_cast<double>(t.b), static_cast<double>(t.c))};
+        const auto actual{format(t)};
+        ASSERT_EQ(streamFormat(t, solution), actual);
+        ASSERT_LE(actual.size(), MAX_RESULT_LENGTH);
+    }
+}
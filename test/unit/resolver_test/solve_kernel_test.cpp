@@ -0,0 +1,113 @@
+#include "resolver/solve_kernel.h"
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <random>
+
+using namespace testing;
+using namespace tektask::resolver;
+using namespace tektask::utils::types;
+
+namespace
+{
+    bool bitEqual(double lhs, double rhs)
+    {
+        return std::memcmp(&lhs, &rhs, sizeof(double)) == 0;
+    }
+
+    /**
+     * @brief Generates coefficients covering every solution kind and a wide range of magnitudes.
+     */
+    std::vector<std::array<double, 3>> generateCoefficients(std::size_t count)
+    {
+        std::vector<std::array<double, 3>> coefficients{
+            {0, 0, 0}, {0, 0, 5}, {0, 5, -10}, {0, -3, 0}, {1, -4, 3}, {1, -2, -3},
+            {1, 0, 1}, {1, 2, 1}, {2, -6, -8}, {2, 8, 8}, {1, 0, 0}, {-1, 0, 0},
+        };
+
+        std::mt19937_64 engine{42};
+        std::uniform_int_distribution<int64_t> small(-10, 10);
+        std::uniform_int_distribution<int64_t> medium(-(1 << 26), 1 << 26);
+        std::uniform_int_distribution<int64_t> full{};
+
+        while (coefficients.size() < count)
+        {
+            // perfect square discriminant, single root
+            const auto k{small(engine)};
+            const auto m{small(engine)};
+            coefficients.push_back({double(k), double(2 * k * m), double(k * m * m)});
+
+            coefficients.push_back({double(small(engine)), double(small(engine)), double(small(engine))});
+            coefficients.push_back({double(medium(engine)), double(medium(engine)), double(medium(engine))});
+            coefficients.push_back({double(full(engine)), double(full(engine)), double(full(engine))});
+        }
+        return coefficients;
+    }
+}
+
+
+TEST(SolveKernelTest, Solve_AllSolutionKinds)
+{
+    ASSERT_EQ(solve(0, 0, 0).kind, SolveCase::InfiniteRoots);
+    ASSERT_EQ(solve(0, 0, 5).kind, SolveCase::NoSolution);
+    ASSERT_EQ(solve(0, 5, -10), (EquationSolution{SolveCase::Linear, 2.0}));
+    ASSERT_EQ(solve(1, 0, 1), (EquationSolution{SolveCase::NoRealRoots, 0.0, 0.0, 0.0}));
+    ASSERT_EQ(solve(1, 2, 1), (EquationSolution{SolveCase::SingleRoot, -1.0, 0.0, -1.0}));
+    ASSERT_EQ(solve(1, -2, -3), (EquationSolution{SolveCase::TwoRoots, 3.0, -1.0, 1.0}));
+
+    // xMin is normalized, single root is kept as is
+    const auto solution{solve(1, 0, 0)};
+    ASSERT_FALSE(std::signbit(solution.xMin));
+    ASSERT_TRUE(std::signbit(solution.x1));
+}
+
+TEST(SolveKernelTest, SolveBlock_BitIdenticalToScalar)
+{
+    const auto coefficients{generateCoefficients(10'000)};
+
+    for (auto isa : {SolveKernelIsa::Scalar, SolveKernelIsa::Sse2, SolveKernelIsa::Avx2})
+    {
+        CoefficientBlock block{};
+        SolutionBlock solutions{};
+
+        for (std::size_t offset = 0; offset < coefficients.size(); offset += SOLVE_BLOCK_SIZE - 1)
+        {
+            // odd block sizes exercise the scalar tail of vector kernels
+            block.size = std::min(SOLVE_BLOCK_SIZE - 1, coefficients.size() - offset);
+            for (std::size_t i = 0; i < block.size; ++i)
+            {
+                block.a[i] = coefficients[offset + i][0];
+                block.b[i] = coefficients[offset + i][1];
+                block.c[i] = coefficients[offset + i][2];
+            }
+
+            solveBlock(block, solutions, isa);
+
+            for (std::size_t i = 0; i < block.size; ++i)
+            {
+                const auto expected{solve(block.a[i], block.b[i], block.c[i])};
+                ASSERT_EQ(expected.kind, solutions.kind[i]) << "isa=" << int(isa) << " lane=" << offset + i;
+                ASSERT_TRUE(bitEqual(expected.x1, solutions.x1[i])) << "isa=" << int(isa) << " lane=" << offset + i;
+                ASSERT_TRUE(bitEqual(expected.x2, solutions.x2[i])) << "isa=" << int(isa) << " lane=" << offset + i;
+                ASSERT_TRUE(bitEqual(expected.xMin, solutions.xMin[i])) << "isa=" << int(isa) << " lane=" << offset + i;
+            }
+        }
+    }
+}
+
+TEST(SolveKernelTest, SolveBlock_RuntimeDispatch)
+{
+    CoefficientBlock block{};
+    block.size = 3;
+    block.a = {1, 0, 1};
+    block.b = {-2, 10, 2};
+    block.c = {-3, -10, 1};
+
+    SolutionBlock solutions{};
+    solveBlock(block, solutions);
+
+    ASSERT_EQ(solutions.kind[0], SolveCase::TwoRoots);
+    ASSERT_EQ(solutions.kind[1], SolveCase::Linear);
+    ASSERT_EQ(solutions.kind[2], SolveCase::SingleRoot);
+    ASSERT_EQ(solutions.x1[1], 1.0);
+}
@@ -0,0 +1,211 @@
+#include "server/solver_server.h"
+#include "io/endian.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+#include <sys/un.h>
+#include <sys/socket.h>
+
+using namespace testing;
+using namespace tektask::io;
+using namespace tektask::server;
+using namespace tektask::thread;
+
+namespace
+{
+    Frame textRequest(std::string text)
+    {
+        return {static_cast<uint8_t>(PayloadFormat::Text), std::move(text)};
+    }
+
+    Frame binaryRequest(const std::vector<std::array<int64_t, 3>>& records)
+    {
+        Frame frame{static_cast<uint8_t>(PayloadFormat::Binary), std::string(records.size() * 24, '\0')};
+        auto* out{reinterpret_cast<std::byte*>(frame.payload.data())};
+        for (const auto& record : records)
+        {
+            for (const auto value : record)
+            {
+                storeLittleEndian(value, out);
+                out += sizeof(int64_t);
+            }
+        }
+        return frame;
+    }
+
+    constexpr auto OK{static_cast<uint8_t>(ResponseStatus::Ok)};
+    constexpr auto ERROR{static_cast<uint8_t>(ResponseStatus::Error)};
+}
+
+
+TEST(ProtocolTest, FrameRoundTrip)
+{
+    int fds[2];
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+
+    writeFrame(fds[0], 1, "payload");
+    writeFrame(fds[0], 0, "");
+    ::close(fds[0]);
+
+    Frame frame{};
+    ASSERT_TRUE(readFrame(fds[1], frame));
+    EXPECT_EQ(frame.kind, 1);
+    EXPECT_EQ(frame.payload, "payload");
+    ASSERT_TRUE(readFrame(fds[1], frame));
+    EXPECT_EQ(frame.kind, 0);
+    EXPECT_TRUE(frame.payload.empty());
+    EXPECT_FALSE(readFrame(fds[1], frame));
+    ::close(fds[1]);
+}
+
+TEST(ProtocolTest, MalformedFrame)
+{
+    int fds[2];
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+
+    const std::string garbage(FRAME_HEADER_SIZE, 'x');
+    ASSERT_EQ(::write(fds[0], garbage.data(), garbage.size()), static_cast<ssize_t>(garbage.size()));
+    ::close(fds[0]);
+
+    Frame frame{};
+    EXPECT_THROW(readFrame(fds[1], frame), std::runtime_error);
+    ::close(fds[1]);
+}
+
+TEST(SolverServerTest, Solve_TextRequest)
+{
+    ThreadPool pool{2};
+    SolverServer server{pool};
+
+    const auto response{server.solve(textRequest("1 -2 -3\n1 x 3 0 0 0 4 5"))};
+    EXPECT_EQ(response.kind, OK);
+    EXPECT_EQ(response.payload,
+              "(1,x,3) => Invalid input: failed to parse triplet\n"
+              "(4,5,) => Invalid input: parameter count must be a multiple of 3!\n"
+              "\n"
+              "(1, -2, -3) => (3, -1), Xmin=1\n"
+              "(0, 0, 0) => infinite roots, no extremum\n");
+}
+
+TEST(SolverServerTest, Solve_BinaryRequest)
+{
+    ThreadPool pool{2};
+    SolverServer server{pool};
+
+    const auto response{server.solve(binaryRequest({{1, -2, -3}, {0, 0, 0}}))};
+    EXPECT_EQ(response.kind, OK);
+    EXPECT_EQ(response.payload, "\n(1, -2, -3) => (3, -1), Xmin=1\n(0, 0, 0) => infinite roots, no extremum\n");
+}
+
+TEST(SolverServerTest, Solve_InvalidRequests)
+{
+    ThreadPool pool{1};
+    SolverServer server{pool};
+
+    auto response{server.solve(textRequest("1 a 3"))};
+    EXPECT_EQ(response.kind, ERROR);
+    EXPECT_EQ(response.payload, "(1,a,3) => Invalid input: failed to parse triplet\nInvalid input: no valid parameters");
+
+    response = server.solve(Frame{static_cast<uint8_t>(PayloadFormat::Binary), std::string(25, '\0')});
+    EXPECT_EQ(response.kind, ERROR);
+
+    response = server.solve(Frame{7, "1 2 3"});
+    EXPECT_EQ(response.kind, ERROR);
+}
+
+TEST(SolverServerTest, Solve_ConcurrentRequests)
+{
+    ThreadPool pool{3};
+    SolverServer server{pool};
+
+    // every client sends its own coefficients, results must not mix between requests
+    constexpr int CLIENTS{8};
+    constexpr int TRIPLETS{5000};
+    std::vector<std::thread> clients{};
+    std::vector<char> matches(CLIENTS, 0);
+    for (int client = 0; client < CLIENTS; ++client)
+    {
+        clients.emplace_back([&server, &matches, client]
+        {
+            std::string text{};
+            std::string expected{"\n"};
+            for (int i = 0; i < TRIPLETS; ++i)
+            {
+                const auto root{std::to_string(client * TRIPLETS + i + 1)};
+                text += "0 1 -" + root + " ";
+                expected += "(0, 1, -" + root + ") => (" + root + "), no extremum\n";
+            }
+            const auto response{server.solve(textRequest(text))};
+            matches[client] = response.kind == OK && response.payload == expected ? 1 : 0;
+        });
+    }
+    for (auto& client : clients)
+    {
+        client.join();
+    }
+
+    for (int client = 0; client < CLIENTS; ++client)
+    {
+        EXPECT_EQ(matches[client], 1) << client;
+    }
+}
+
+TEST(SolverServerTest, Serve_UnixSocket)
+{
+    const std::string path{"/tmp/se_solver_test_" + std::to_string(::getpid()) + ".sock"};
+
+    ThreadPool pool{2};
+    SolverServer server{pool};
+    std::thread serving{[&server, &path] { server.serve(path); }};
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    path.copy(address.sun_path, path.size());
+
+    const int fd{::socket(AF_UNIX, SOCK_STREAM, 0)};
+    bool connected{false};
+    for (int attempt = 0; attempt < 500 && !connected; ++attempt)
+    {
+        connected = ::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+        if (!connected)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+    ASSERT_TRUE(connected);
+
+    // several requests over a single connection
+    Frame response{};
+    for (int i = 0; i < 3; ++i)
+    {
+        writeFrame(fd, static_cast<uint8_t>(PayloadFormat::Text), "1 -2 -3");
+        ASSERT_TRUE(readFrame(fd, response));
+        EXPECT_EQ(response.kind, OK);
+        EXPECT_EQ(response.payload, "\n(1, -2, -3) => (3, -1), Xmin=1\n");
+    }
+
+    // stop closes connected clients
+    server.stop();
+    EXPECT_FALSE(readFrame(fd, response));
+    ::close(fd);
+    serving.join();
+    EXPECT_NE(::access(path.c_str(), F_OK), 0);
+}
+
+TEST(SolverServerTest, Serve_KeepsNonSocketPath)
+{
+    const std::string path{"/tmp/se_solver_test_" + std::to_string(::getpid()) + ".txt"};
+    std::ofstream{path} << "1 -2 -3\n";
+
+    ThreadPool pool{1};
+    SolverServer server{pool};
+    ASSERT_THROW(server.serve(path), std::invalid_argument);
+    EXPECT_EQ(::access(path.c_str(), F_OK), 0);
+    ::unlink(path.c_str());
+}
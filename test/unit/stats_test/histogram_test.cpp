@@ -0,0 +1,66 @@
+#include "stats/histogram.h"
+
+#include <gtest/gtest.h>
+
+using namespace testing;
+using namespace tektask::stats;
+
+
+TEST(HistogramTest, Empty)
+{
+    const Histogram histogram{};
+    ASSERT_EQ(histogram.count(), 0);
+    ASSERT_EQ(histogram.sum(), 0);
+    ASSERT_EQ(histogram.min(), 0);
+    ASSERT_EQ(histogram.max(), 0);
+    ASSERT_EQ(histogram.mean(), 0);
+    ASSERT_EQ(histogram.percentile(0.99), 0);
+}
+
+TEST(HistogramTest, Record_TracksSummaryAndPercentiles)
+{
+    Histogram histogram{};
+    for (uint64_t value = 1; value <= 1000; ++value)
+    {
+        histogram.record(value);
+    }
+
+    ASSERT_EQ(histogram.count(), 1000);
+    ASSERT_EQ(histogram.sum(), 500500);
+    ASSERT_EQ(histogram.min(), 1);
+    ASSERT_EQ(histogram.max(), 1000);
+    ASSERT_EQ(histogram.mean(), 500);
+
+    // percentiles are bucket upper bounds, never below the exact value, within a factor of two
+    ASSERT_EQ(histogram.percentile(0.5), 511);
+    ASSERT_EQ(histogram.percentile(0.99), 1000);
+    ASSERT_EQ(histogram.percentile(0.0), 1);
+}
+
+TEST(HistogramTest, Record_WeightAndZero)
+{
+    Histogram histogram{};
+    histogram.record(0);
+    histogram.record(100, 9);
+
+    ASSERT_EQ(histogram.count(), 10);
+    ASSERT_EQ(histogram.sum(), 900);
+    ASSERT_EQ(histogram.min(), 0);
+    ASSERT_EQ(histogram.percentile(0.1), 0);
+    ASSERT_EQ(histogram.percentile(0.5), 100);
+}
+
+TEST(HistogramTest, Merge)
+{
+    Histogram first{};
+    Histogram second{};
+    first.record(10);
+    second.record(5);
+    second.record(1u << 20);
+
+    first.merge(second);
+    ASSERT_EQ(first.count(), 3);
+    ASSERT_EQ(first.min(), 5);
+    ASSERT_EQ(first.max(), 1u << 20);
+    ASSERT_EQ(first.sum(), 15 + (1u << 20));
+}
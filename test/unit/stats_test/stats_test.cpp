@@ -0,0 +1,141 @@
+#include "stats/stats.h"
+#include "queue/blocking_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <sstream>
+
+using namespace testing;
+using namespace tektask::queue;
+using namespace tektask::stats;
+using namespace tektask::utils::types;
+
+namespace
+{
+    uint64_t counter(const Report& report, Counter counter)
+    {
+        return report.counters[static_cast<std::size_t>(counter)];
+    }
+
+    const Histogram& stage(const Report& report, Stage stage)
+    {
+        return report.stages[static_cast<std::size_t>(stage)];
+    }
+}
+
+
+TEST(StatsTest, Collect_MergesThreads)
+{
+    if constexpr (!STATS_COMPILED_IN)
+    {
+        GTEST_SKIP();
+    }
+
+    // registry is process wide, compare against the state before the test
+    const auto before{collect()};
+
+    std::vector<std::thread> threads{};
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([]
+        {
+            count(Counter::ParsedTriplets, 10);
+            countCase(SolveCase::TwoRoots);
+            record(Stage::Output, 100);
+            ScopedTimer timer{Stage::Resolve, 8};
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto after{collect()};
+    ASSERT_EQ(after.threadCount, before.threadCount + 4);
+    ASSERT_EQ(counter(after, Counter::ParsedTriplets), counter(before, Counter::ParsedTriplets) + 40);
+    ASSERT_EQ(counter(after, Counter::TwoRoots), counter(before, Counter::TwoRoots) + 4);
+    ASSERT_EQ(stage(after, Stage::Output).count(), stage(before, Stage::Output).count() + 4);
+    ASSERT_EQ(stage(after, Stage::Resolve).count(), stage(before, Stage::Resolve).count() + 32);
+}
+
+TEST(StatsTest, QueueWait_SampledIds)
+{
+    if constexpr (!STATS_COMPILED_IN)
+    {
+        GTEST_SKIP();
+    }
+
+    const auto before{stage(collect(), Stage::QueueWait).count()};
+
+    // ids 0 and QUEUE_SAMPLE_RATE are sampled, the rest are not
+    markPushed(0, QUEUE_SAMPLE_RATE + 1);
+    for (int64_t id = 0; id <= QUEUE_SAMPLE_RATE; ++id)
+    {
+        markPopped(id);
+    }
+    ASSERT_EQ(stage(collect(), Stage::QueueWait).count(), before + 2);
+}
+
+TEST(StatsTest, BlockingQueue_CountsEmptyQueueWaits)
+{
+    if constexpr (!STATS_COMPILED_IN)
+    {
+        GTEST_SKIP();
+    }
+
+    const auto before{counter(collect(), Counter::EmptyQueueWaits)};
+
+    BlockingQueue<Triplet> queue{};
+    std::thread consumer([&queue]
+    {
+        Triplet item{};
+        while (queue.waitPop(item))
+        {
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    queue.shutdown();
+    consumer.join();
+
+    ASSERT_GE(counter(collect(), Counter::EmptyQueueWaits), before + 1);
+}
+
+TEST(StatsTest, BlockingQueue_CountsFullQueueWaits)
+{
+    if constexpr (!STATS_COMPILED_IN)
+    {
+        GTEST_SKIP();
+    }
+
+    const auto before{counter(collect(), Counter::FullQueueWaits)};
+
+    BlockingQueue<Triplet> queue{1};
+    queue.waitPush(Triplet{});
+    std::thread producer([&queue]
+    {
+        queue.waitPush(Triplet{});
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    queue.shutdown();
+    producer.join();
+
+    ASSERT_GE(counter(collect(), Counter::FullQueueWaits), before + 1);
+}
+
+TEST(StatsTest, WriteJson_ContainsStagesAndCounters)
+{
+    Report report{};
+    report.threadCount = 2;
+    report.stages[static_cast<std::size_t>(Stage::Parse)].record(1000);
+    report.counters[static_cast<std::size_t>(Counter::LockWaits)] = 7;
+
+    std::ostringstream out{};
+    writeJson(report, out);
+
+    const auto json{out.str()};
+    ASSERT_NE(json.find("\"threads\":2"), std::string::npos);
+    ASSERT_NE(json.find("\"parse\":{\"count\":1,\"total_ns\":1000"), std::string::npos);
+    ASSERT_NE(json.find("\"lock_waits\":7"), std::string::npos);
+    ASSERT_NE(json.find("\"two_roots\":0"), std::string::npos);
+}
@@ -0,0 +1,69 @@
+#include "storage/segmented_storage.h"
+
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace testing;
+using namespace tektask::storage;
+
+TEST(SegmentedStorageTest, Resize_KeepsStoredElements)
+{
+    SegmentedStorage<int, 4> storage{};
+    ASSERT_EQ(storage.size(), 0);
+
+    storage.resize(3);
+    int* first{&storage[0]};
+    for (int i = 0; i < 3; ++i)
+    {
+        storage[i] = i;
+    }
+
+    // growing never relocates already stored elements
+    storage.resize(10);
+    storage.resize(5);
+    ASSERT_EQ(storage.size(), 10);
+    ASSERT_EQ(first, &storage[0]);
+
+    for (int i = 3; i < 10; ++i)
+    {
+        storage[i] = i;
+    }
+    for (int i = 0; i < 10; ++i)
+    {
+        ASSERT_EQ(storage[i], i);
+    }
+}
+
+TEST(SegmentedStorageTest, Resize_ThrowsIfCapacityExceeded)
+{
+    SegmentedStorage<int, 4> storage{2};
+    ASSERT_NO_THROW(storage.resize(8));
+    ASSERT_THROW(storage.resize(9), std::length_error);
+}
+
+TEST(SegmentedStorageTest, ConcurrentWrites_WhileGrowing)
+{
+    static constexpr int COUNT{100000};
+    SegmentedStorage<int, 128> storage{};
+
+    storage.resize(COUNT / 2);
+    std::thread writer([&]
+    {
+        for (int i = 0; i < COUNT / 2; ++i)
+        {
+            storage[i] = i;
+        }
+    });
+
+    storage.resize(COUNT);
+    for (int i = COUNT / 2; i < COUNT; ++i)
+    {
+        storage[i] = i;
+    }
+    writer.join();
+
+    for (int i = 0; i < COUNT; ++i)
+    {
+        ASSERT_EQ(storage[i], i);
+    }
+}
@@ -0,0 +1,53 @@
+#include "storage/text_arena.h"
+
+#include <gtest/gtest.h>
+#include <cstring>
+
+using namespace testing;
+using namespace tektask::storage;
+
+TEST(TextArenaTest, Commit_ViewsStayValidAcrossBlocks)
+{
+    TextArena arena{16};
+    std::vector<std::string_view> views{};
+    std::vector<std::string> expected{};
+
+    for (int i = 0; i < 100; ++i)
+    {
+        const auto text{std::to_string(i * 12345)};
+        char* out{arena.reserve(10)};
+        std::memcpy(out, text.data(), text.size());
+        views.emplace_back(arena.commit(text.size()));
+        expected.emplace_back(text);
+    }
+
+    for (std::size_t i = 0; i < views.size(); ++i)
+    {
+        ASSERT_EQ(views[i], expected[i]);
+    }
+}
+
+TEST(TextArenaTest, Reserve_LargerThanBlock)
+{
+    TextArena arena{4};
+
+    const std::string text(100, 'x');
+    char* out{arena.reserve(text.size())};
+    std::memcpy(out, text.data(), text.size());
+    ASSERT_EQ(arena.commit(text.size()), text);
+    ASSERT_EQ(arena.size(), text.size());
+}
+
+TEST(TextArenaTest, Reserve_ReusesBlockUntilExhausted)
+{
+    TextArena arena{64};
+
+    // unused reserved space is handed out again
+    char* first{arena.reserve(8)};
+    arena.commit(3);
+    char* second{arena.reserve(8)};
+    ASSERT_EQ(first + 3, second);
+
+    arena.commit(0);
+    ASSERT_EQ(second, arena.reserve(8));
+}
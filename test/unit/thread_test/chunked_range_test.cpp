@@ -0,0 +1,76 @@
+#include "thread/chunked_range.h"
+#include "thread/thread_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace testing;
+using namespace tektask::thread;
+
+
+TEST(ChunkedRangeTest, Claim_GuidedChunksCoverRange)
+{
+    std::vector<int> items(1000);
+    ChunkedRange<int> range{items.data(), items.size(), 2, 16};
+
+    std::vector<std::size_t> sizes{};
+    const int* expected{items.data()};
+    const int* chunk{nullptr};
+    std::size_t count{0};
+    while (range.claim(chunk, count))
+    {
+        ASSERT_EQ(chunk, expected);
+        expected += count;
+        sizes.push_back(count);
+    }
+
+    ASSERT_EQ(expected, items.data() + items.size());
+    ASSERT_FALSE(range.claim(chunk, count));
+
+    // a quarter of the remaining items first, shrinking down to the minimum chunk, the last one is the rest
+    ASSERT_EQ(sizes.front(), 250);
+    for (std::size_t i = 1; i < sizes.size(); ++i)
+    {
+        ASSERT_LE(sizes[i], sizes[i - 1]);
+    }
+    ASSERT_EQ(sizes[sizes.size() - 2], 16);
+    ASSERT_LE(sizes.back(), 16);
+}
+
+TEST(ChunkedRangeTest, Claim_EmptyRange)
+{
+    ChunkedRange<int> range{nullptr, 0, 4, 16};
+
+    const int* chunk{nullptr};
+    std::size_t count{0};
+    ASSERT_FALSE(range.claim(chunk, count));
+}
+
+TEST(ChunkedRangeTest, ConcurrentClaims_ProcessEveryItemOnce)
+{
+    static constexpr std::size_t COUNT{100003};
+
+    std::vector<int> items(COUNT);
+    std::vector<int> visits(COUNT);
+    ThreadPool pool{4};
+    ChunkedRange<int> range{items.data(), items.size(), pool.size(), 7};
+
+    pool.run([&](uint32_t)
+    {
+        const int* chunk{nullptr};
+        std::size_t count{0};
+        while (range.claim(chunk, count))
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                ++visits[chunk + i - items.data()];
+            }
+        }
+    });
+
+    for (std::size_t i = 0; i < COUNT; ++i)
+    {
+        ASSERT_EQ(visits[i], 1) << "item " << i;
+    }
+}
@@ -0,0 +1,53 @@
+#include "thread/cpu_topology.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+using namespace testing;
+using namespace tektask::thread;
+
+
+TEST(CpuTopologyTest, ParseCpuList)
+{
+    EXPECT_EQ(parseCpuList("3"), (std::vector<int>{3}));
+    EXPECT_EQ(parseCpuList("0-3,8"), (std::vector<int>{0, 1, 2, 3, 8}));
+    EXPECT_EQ(parseCpuList("8,2-3,3"), (std::vector<int>{2, 3, 8}));
+    EXPECT_EQ(parseCpuList("0x5"), (std::vector<int>{0, 2}));
+    EXPECT_EQ(parseCpuList("0xf0"), (std::vector<int>{4, 5, 6, 7}));
+    EXPECT_EQ(parseCpuList("0X100"), (std::vector<int>{8}));
+}
+
+TEST(CpuTopologyTest, ParseCpuList_Invalid)
+{
+    for (const auto* text : {"", ",", "1,", "a", "-1", "3-1", "1-", "0x", "0x0", "0xg", "99999"})
+    {
+        EXPECT_THROW(parseCpuList(text), std::invalid_argument) << text;
+    }
+}
+
+TEST(CpuTopologyTest, Place_FillsProducerNodeFirst)
+{
+    // cpus 0-3 on node 0, 4-7 on node 1
+    const CpuTopology topology{{0, 1, 2, 3, 4, 5, 6, 7}, {0, 0, 0, 0, 1, 1, 1, 1}};
+
+    EXPECT_EQ(topology.nodeOf(5), 1);
+    EXPECT_EQ(topology.nodeOf(100), 0);
+    EXPECT_EQ(topology.place({}, 6, 0), (std::vector<int>{0, 1, 2, 3, 4, 5}));
+    EXPECT_EQ(topology.place({}, 6, 6), (std::vector<int>{4, 5, 6, 7, 0, 1}));
+    EXPECT_EQ(topology.place({1, 5}, 3, 5), (std::vector<int>{5, 1, 5}));
+    EXPECT_TRUE(topology.place({}, 0).empty());
+}
+
+TEST(CpuTopologyTest, Place_RejectsUnavailableCpu)
+{
+    const CpuTopology topology{{0, 1}, {}};
+    EXPECT_THROW((void)topology.place({1, 2}, 2), std::invalid_argument);
+}
+
+TEST(CpuTopologyTest, Detect)
+{
+    const auto topology{CpuTopology::detect()};
+    const auto placement{topology.place({}, 3)};
+    ASSERT_EQ(placement.size(), topology.allowedCpus().empty() ? 0 : 3);
+}
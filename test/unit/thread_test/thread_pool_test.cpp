@@ -0,0 +1,106 @@
+#include "thread/thread_pool.h"
+#include "thread/cpu_topology.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <stdexcept>
+
+using namespace testing;
+using namespace tektask::thread;
+
+
+TEST(ThreadPoolTest, Run_CallsEveryWorkerOnce)
+{
+    ThreadPool pool{4};
+    ASSERT_EQ(pool.size(), 4);
+
+    for (int round = 0; round < 100; ++round)
+    {
+        std::array<std::atomic<int>, 4> calls{};
+        pool.run([&calls](uint32_t worker) { ++calls[worker]; });
+        for (const auto& count : calls)
+        {
+            ASSERT_EQ(count.load(), 1);
+        }
+    }
+}
+
+TEST(ThreadPoolTest, StartWait_RunsConcurrently)
+{
+    ThreadPool pool{2};
+    std::atomic<int> arrived{0};
+
+    // every worker waits for the other one, completes only if both run at the same time
+    pool.start([&arrived](uint32_t)
+    {
+        ++arrived;
+        while (arrived.load() < 2)
+        {
+        }
+    });
+    pool.wait();
+    EXPECT_EQ(arrived.load(), 2);
+}
+
+TEST(ThreadPoolTest, Wait_RethrowsTaskException)
+{
+    ThreadPool pool{3};
+    pool.start([](uint32_t worker)
+    {
+        if (worker == 1)
+        {
+            throw std::runtime_error("failed");
+        }
+    });
+    EXPECT_THROW(pool.wait(), std::runtime_error);
+
+    // pool stays usable
+    std::atomic<int> calls{0};
+    pool.run([&calls](uint32_t) { ++calls; });
+    EXPECT_EQ(calls.load(), 3);
+}
+
+TEST(ThreadPoolTest, PinnedWorkers)
+{
+    const auto topology{CpuTopology::detect()};
+    if (topology.allowedCpus().empty())
+    {
+        GTEST_SKIP() << "CPU affinity is not available";
+    }
+
+    const auto placement{topology.place({}, 2)};
+    ThreadPool pool{2, placement};
+    EXPECT_EQ(pool.cpuOf(0), placement[0]);
+    EXPECT_EQ(pool.cpuOf(1), placement[1]);
+    EXPECT_EQ(pool.cpuOf(2), -1);
+
+    std::array<int, 2> running{};
+    pool.run([&running](uint32_t worker) { running[worker] = currentCpu(); });
+    EXPECT_EQ(running[0], placement[0]);
+    EXPECT_EQ(running[1], placement[1]);
+}
+
+TEST(ThreadPoolTest, RunParts_RunsEveryPartOnceOnPool)
+{
+    ThreadPool pool{2};
+    std::array<std::atomic<int>, 7> calls{};
+    runParts(calls.size(), [&calls](std::size_t i) { ++calls[i]; }, &pool);
+    for (const auto& count : calls)
+    {
+        EXPECT_EQ(count.load(), 1);
+    }
+
+    // a failing part of the calling thread waits for the workers
+    std::atomic<int> finished{0};
+    EXPECT_THROW(runParts(3, [&finished](std::size_t i)
+    {
+        if (i == 0)
+        {
+            throw std::runtime_error("failed");
+        }
+        ++finished;
+    }, &pool), std::runtime_error);
+    EXPECT_EQ(finished.load(), 2);
+}